@@ -0,0 +1,129 @@
+/***********************************************************************
+ * Source File:
+ *    ALLOC SCOPE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Count the heap allocations made while a scope is open. This is
+ *    PieceSpy for every type: the global operator new and delete are
+ *    replaced, and they count into the scopes open on the calling
+ *    thread. With no scope open they only pay for one check. The
+ *    replacements are only built with ALLOC_SCOPE defined, as the test
+ *    and bench builds are; otherwise the scopes count nothing
+ ************************************************************************/
+
+#include "allocScope.h"
+#include <cstdlib>
+#include <new>
+
+// the innermost scope open on each thread
+static thread_local AllocScope* pCurrent = nullptr;
+
+/***************************************************
+ * ALLOC SCOPE : CONSTRUCTOR
+ * Open the scope, inside whatever scope is already open
+ ***************************************************/
+AllocScope::AllocScope(const char* name) :
+   name(name), allocations(0), bytes(0), frees(0), pParent(pCurrent)
+{
+   pCurrent = this;
+}
+
+/***************************************************
+ * ALLOC SCOPE : DESTRUCTOR
+ * Close the scope. Scopes are objects on the stack,
+ * so they close in the reverse order they opened
+ ***************************************************/
+AllocScope::~AllocScope()
+{
+   pCurrent = pParent;
+}
+
+/***************************************************
+ * ALLOC SCOPE : COUNT NEW
+ ***************************************************/
+void AllocScope::countNew(size_t size)
+{
+   for (AllocScope* pScope = pCurrent; pScope; pScope = pScope->pParent)
+   {
+      pScope->allocations++;
+      pScope->bytes += size;
+   }
+}
+
+/***************************************************
+ * ALLOC SCOPE : COUNT DELETE
+ ***************************************************/
+void AllocScope::countDelete()
+{
+   for (AllocScope* pScope = pCurrent; pScope; pScope = pScope->pParent)
+      pScope->frees++;
+}
+
+#ifdef ALLOC_SCOPE
+/***************************************************
+ * OPERATOR NEW and DELETE
+ * The replacements for the whole program. The array, sized, and
+ * nothrow forms are replaced as well, since a library may supply its
+ * own (std::stable_sort's buffer uses the nothrow ones). A build
+ * without ALLOC_SCOPE, the game's, keeps the library's
+ ***************************************************/
+void* operator new(size_t size)
+{
+   if (pCurrent)
+      AllocScope::countNew(size);
+   void* p = malloc(size ? size : 1);
+   if (p == nullptr)
+      throw std::bad_alloc();
+   return p;
+}
+
+void* operator new[](size_t size)
+{
+   return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+   if (p && pCurrent)
+      AllocScope::countDelete();
+   free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+   operator delete(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+   operator delete(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+   operator delete(p);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+   if (pCurrent)
+      AllocScope::countNew(size);
+   return malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept
+{
+   return operator new(size, tag);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+   operator delete(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+   operator delete(p);
+}
+#endif // ALLOC_SCOPE
@@ -0,0 +1,58 @@
+/***********************************************************************
+ * Header File:
+ *    ALLOC SCOPE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Count the heap allocations made while a scope is open. This is
+ *    PieceSpy for every type: the global operator new and delete are
+ *    replaced, and they count into the scopes open on the calling
+ *    thread. With no scope open they only pay for one check. The
+ *    replacements are only built with ALLOC_SCOPE defined, as the test
+ *    and bench builds are; otherwise the scopes count nothing
+ ************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+/***************************************************
+ * ALLOC SCOPE
+ * Everything allocated and freed on this thread from
+ * construction to destruction. Scopes nest: an allocation
+ * in an inner scope is counted in the outer ones as well
+ ***************************************************/
+class AllocScope
+{
+public:
+   AllocScope(const char* name = "");
+   ~AllocScope();
+   AllocScope(const AllocScope&) = delete;
+   AllocScope& operator = (const AllocScope&) = delete;
+
+   const char* getName()        const { return name;        }
+   size_t      getAllocations() const { return allocations; }
+   size_t      getBytes()       const { return bytes;       }
+   size_t      getFrees()       const { return frees;       }
+
+   // start counting again from zero
+   void reset() { allocations = bytes = frees = 0; }
+
+   // whether operator new and delete count, that is, built with ALLOC_SCOPE
+#ifdef ALLOC_SCOPE
+   static const bool enabled = true;
+#else
+   static const bool enabled = false;
+#endif
+
+   // called by operator new and delete
+   static void countNew(size_t size);
+   static void countDelete();
+
+private:
+   const char* name;
+   size_t allocations;    // calls to operator new
+   size_t bytes;          // bytes asked of operator new
+   size_t frees;          // calls to operator delete with a pointer
+   AllocScope* pParent;   // the scope this one is nested in
+};
@@ -0,0 +1,66 @@
+/***********************************************************************
+ * Header File:
+ *    BENCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    A fixed amount of work over a fixed set of positions on one
+ *    thread. The time gives the speed, and the total node count is a
+ *    signature of the behavior: a change that alters it changed what
+ *    the program does, not just how fast
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iostream>
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+class TestBench;
+
+/***************************************************
+ * BENCH
+ * Perft or search every bench position to the same depth
+ ***************************************************/
+class Bench
+{
+   friend TestBench;
+public:
+   // what one position took
+   struct Result
+   {
+      string   fen;
+      uint64_t nodes;
+      double   seconds;
+   };
+
+   // what each position is put through
+   enum Mode { PERFT, SEARCH };
+
+   // the size of the table each search starts with
+   static const int HASH_MEGABYTES = 16;
+
+   Bench(int depth = 3, Mode mode = PERFT) : depth(depth), mode(mode) {}
+
+   // run every position, printing a line for each
+   vector<Result> run(ostream& out) const;
+
+   // the sum of the node counts, the signature of a run
+   static uint64_t getNodes(const vector<Result>& results);
+
+   static const vector<const char*>& getPositions();
+
+private:
+   Result run(const char* fen) const;
+
+   int depth;
+   Mode mode;
+};
+
+// the "bench [--search] [depth]" command line mode
+int benchCommand(int argc, char** argv);
@@ -0,0 +1,299 @@
+/***********************************************************************
+ * Source File:
+ *    BENCH REPORT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Benchmark results as JSON, one record per line, and the
+ *    comparison of a run against a stored baseline so that a slower
+ *    move generator or Board::move() is caught before it ships
+ ************************************************************************/
+
+#include "benchReport.h"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+using namespace std;
+
+#ifdef _WIN32
+#define popen  _popen
+#define pclose _pclose
+#endif
+
+/***************************************************
+ * BENCH REPORT : WRITE
+ * One JSON object per line, so a file can be appended to,
+ * read a line at a time, and compared with line-based tools
+ ***************************************************/
+void BenchReport::write(ostream& out, const vector<Record>& records)
+{
+   for (const Record& record : records)
+   {
+      ostringstream sout;
+      sout << setprecision(10)
+           << "{\"name\": " << quote(record.name)
+           << ", \"revision\": " << quote(record.revision)
+           << ", \"iterations\": " << record.iterations
+           << ", \"repetitions\": " << record.repetitions
+           << ", \"median_ns\": " << record.median
+           << ", \"p95_ns\": " << record.p95
+           << ", \"mean_ns\": " << record.mean
+           << ", \"stddev_ns\": " << record.stdDev
+           << ", \"min_ns\": " << record.min
+           << ", \"allocations\": " << record.allocations
+           << ", \"bytes\": " << record.bytes << "}\n";
+      out << sout.str();
+   }
+}
+
+/***************************************************
+ * BENCH REPORT : READ
+ * Every line that holds a record. Blank lines and lines
+ * that are not records are skipped
+ ***************************************************/
+vector<BenchReport::Record> BenchReport::read(istream& in)
+{
+   vector<Record> records;
+   string line;
+   while (getline(in, line))
+   {
+      Record record;
+      if (parse(line, record) && !record.name.empty())
+         records.push_back(record);
+   }
+   return records;
+}
+
+/***************************************************
+ * BENCH REPORT : COMPARE
+ * Each current case against the baseline case of the same name.
+ * The threshold alone would flag the noisy cases on every run, so a
+ * change must also fall outside the baseline's own spread
+ ***************************************************/
+vector<BenchReport::Comparison> BenchReport::compare(const vector<Record>& baseline,
+                                                     const vector<Record>& current,
+                                                     double threshold)
+{
+   vector<Comparison> comparisons;
+   for (const Record& now : current)
+   {
+      Comparison comparison = { now.name, 0.0, now.median, 0.0, ADDED };
+      for (const Record& before : baseline)
+      {
+         if (before.name != now.name)
+            continue;
+         comparison.baseline = before.median;
+         comparison.change = (before.median > 0.0) ? (now.median - before.median) / before.median : 0.0;
+         comparison.status = SAME;
+         if (comparison.change > threshold && now.median > before.p95)
+            comparison.status = REGRESSION;
+         else if (comparison.change < -threshold && now.p95 < before.median)
+            comparison.status = IMPROVEMENT;
+         break;
+      }
+      comparisons.push_back(comparison);
+   }
+
+   // the cases that were measured before but not now
+   for (const Record& before : baseline)
+   {
+      bool found = false;
+      for (const Record& now : current)
+         found = found || now.name == before.name;
+      if (!found)
+         comparisons.push_back({ before.name, before.median, 0.0, 0.0, REMOVED });
+   }
+   return comparisons;
+}
+
+/***************************************************
+ * BENCH REPORT : GET REVISION
+ * The build can define GIT_REVISION. Otherwise ask git,
+ * which works when run from inside the repository
+ ***************************************************/
+string BenchReport::getRevision()
+{
+#ifdef GIT_REVISION
+   return GIT_REVISION;
+#else
+#ifdef _WIN32
+   FILE* pipe = popen("git rev-parse --short HEAD 2>nul", "r");
+#else
+   FILE* pipe = popen("git rev-parse --short HEAD 2>/dev/null", "r");
+#endif
+   if (pipe == nullptr)
+      return "unknown";
+   string revision;
+   char buffer[64];
+   while (fgets(buffer, sizeof(buffer), pipe) != nullptr)
+      revision += buffer;
+   pclose(pipe);
+   while (!revision.empty() && isspace((unsigned char)revision.back()))
+      revision.pop_back();
+   return revision.empty() ? "unknown" : revision;
+#endif
+}
+
+/***************************************************
+ * BENCH REPORT : QUOTE
+ * A JSON string literal
+ ***************************************************/
+string BenchReport::quote(const string& text)
+{
+   string quoted = "\"";
+   for (char c : text)
+   {
+      if (c == '"' || c == '\\')
+         quoted += '\\';
+      if ((unsigned char)c < 0x20)
+         c = ' ';
+      quoted += c;
+   }
+   return quoted + "\"";
+}
+
+/***************************************************
+ * BENCH REPORT : PARSE
+ * One flat JSON object of strings and numbers, as write()
+ * makes. Keys we do not know are skipped
+ ***************************************************/
+bool BenchReport::parse(const string& line, Record& record)
+{
+   size_t i = 0;
+   auto skip = [&]()
+   {
+      while (i < line.size() && isspace((unsigned char)line[i]))
+         i++;
+   };
+   auto readString = [&](string& text)
+   {
+      if (i >= line.size() || line[i] != '"')
+         return false;
+      for (i++; i < line.size() && line[i] != '"'; i++)
+      {
+         if (line[i] == '\\' && i + 1 < line.size())
+            i++;
+         text += line[i];
+      }
+      if (i >= line.size())
+         return false;
+      i++;
+      return true;
+   };
+
+   skip();
+   if (i >= line.size() || line[i] != '{')
+      return false;
+   i++;
+   for (;;)
+   {
+      skip();
+      if (i < line.size() && line[i] == '}')
+         return true;
+
+      string key;
+      if (!readString(key))
+         return false;
+      skip();
+      if (i >= line.size() || line[i] != ':')
+         return false;
+      i++;
+      skip();
+
+      string text;
+      double number = 0.0;
+      if (i < line.size() && line[i] == '"')
+      {
+         if (!readString(text))
+            return false;
+      }
+      else
+      {
+         const char* begin = line.c_str() + i;
+         char* end = nullptr;
+         number = strtod(begin, &end);
+         if (end == begin)
+            return false;
+         i += end - begin;
+      }
+
+      if      (key == "name")        record.name = text;
+      else if (key == "revision")    record.revision = text;
+      else if (key == "iterations")  record.iterations = (int)number;
+      else if (key == "repetitions") record.repetitions = (int)number;
+      else if (key == "median_ns")   record.median = number;
+      else if (key == "p95_ns")      record.p95 = number;
+      else if (key == "mean_ns")     record.mean = number;
+      else if (key == "stddev_ns")   record.stdDev = number;
+      else if (key == "min_ns")      record.min = number;
+      else if (key == "allocations") record.allocations = number;
+      else if (key == "bytes")       record.bytes = number;
+
+      skip();
+      if (i < line.size() && line[i] == ',')
+         i++;
+   }
+}
+
+/***************************************************
+ * BENCH COMPARE COMMAND
+ * Compare two files of records. The exit code is the number
+ * of regressions, so a build can stop on one
+ ***************************************************/
+int benchCompareCommand(int argc, char** argv)
+{
+   string fileBaseline;
+   string fileCurrent;
+   double threshold = 5.0;
+   for (int i = 2; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--threshold" && i + 1 < argc)
+         threshold = atof(argv[++i]);
+      else if (fileBaseline.empty())
+         fileBaseline = arg;
+      else if (fileCurrent.empty())
+         fileCurrent = arg;
+   }
+   if (fileCurrent.empty())
+      fileCurrent = "bench_output.txt";
+
+   ifstream finBaseline(fileBaseline);
+   ifstream finCurrent(fileCurrent);
+   if (fileBaseline.empty() || !finBaseline || !finCurrent)
+   {
+      cerr << "Usage: " << argv[0] << " benchcompare <baseline> [current] "
+           << "[--threshold percent]\n";
+      return 1;
+   }
+   vector<BenchReport::Record> baseline = BenchReport::read(finBaseline);
+   vector<BenchReport::Record> current = BenchReport::read(finCurrent);
+
+   const char* statusText[] = { "same", "REGRESSION", "improved", "new", "removed" };
+   int regressions = 0;
+   cout << left << setw(32) << "Case" << right << setw(12) << "baseline"
+        << setw(12) << "current" << setw(9) << "change" << "  status\n";
+   for (const BenchReport::Comparison& comparison :
+        BenchReport::compare(baseline, current, threshold / 100.0))
+   {
+      cout << left << setw(32) << comparison.name << right
+           << fixed << setprecision(1)
+           << setw(12) << comparison.baseline
+           << setw(12) << comparison.current
+           << setw(8) << comparison.change * 100.0 << "%"
+           << "  " << statusText[comparison.status] << "\n";
+      if (comparison.status == BenchReport::REGRESSION)
+         regressions++;
+   }
+
+   string revisionBaseline = baseline.empty() ? "none" : baseline.front().revision;
+   string revisionCurrent = current.empty() ? "none" : current.front().revision;
+   cout << "\nBaseline:     " << fileBaseline << " (" << revisionBaseline << ")\n"
+        << "Current:      " << fileCurrent << " (" << revisionCurrent << ")\n"
+        << "Threshold:    " << threshold << "%\n"
+        << "Regressions:  " << regressions << "\n";
+   return regressions;
+}
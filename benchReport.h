@@ -0,0 +1,81 @@
+/***********************************************************************
+ * Header File:
+ *    BENCH REPORT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Benchmark results as JSON, one record per line, and the
+ *    comparison of a run against a stored baseline so that a slower
+ *    move generator or Board::move() is caught before it ships
+ ************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+using std::string;
+using std::vector;
+using std::ostream;
+using std::istream;
+
+class TestBenchReport;
+
+/***************************************************
+ * BENCH REPORT
+ * Write, read, and compare benchmark records
+ ***************************************************/
+class BenchReport
+{
+   friend TestBenchReport;
+public:
+   // one benchmark case, times in nanoseconds per operation
+   struct Record
+   {
+      Record() : iterations(0), repetitions(0), median(0.0), p95(0.0),
+                 mean(0.0), stdDev(0.0), min(0.0), allocations(0.0), bytes(0.0) {}
+      string name;
+      string revision;      // the git revision that was measured
+      int    iterations;    // operations in each repetition
+      int    repetitions;   // timed repetitions
+      double median;
+      double p95;
+      double mean;
+      double stdDev;
+      double min;
+      double allocations;   // heap allocations per operation
+      double bytes;         // bytes allocated per operation
+   };
+
+   // how one case changed from the baseline
+   enum Status { SAME, REGRESSION, IMPROVEMENT, ADDED, REMOVED };
+   struct Comparison
+   {
+      string name;
+      double baseline;      // median before, 0 if the case is new
+      double current;       // median now, 0 if the case is gone
+      double change;        // (current - baseline) / baseline
+      Status status;
+   };
+
+   // one JSON object per line, and back again
+   static void write(ostream& out, const vector<Record>& records);
+   static vector<Record> read(istream& in);
+
+   // a case regressed when its median is slower than the baseline median
+   // by more than threshold and also slower than the baseline's own p95
+   static vector<Comparison> compare(const vector<Record>& baseline,
+                                     const vector<Record>& current,
+                                     double threshold);
+
+   // the revision of the working tree, or "unknown"
+   static string getRevision();
+
+private:
+   static string quote(const string& text);
+   static bool parse(const string& line, Record& record);
+};
+
+// the "benchcompare <baseline> <current> [--threshold percent]" command line mode
+int benchCompareCommand(int argc, char** argv);
@@ -18,10 +18,93 @@
 #include "pieceQueen.h"
 #include "pieceKing.h"
 #include "piecePawn.h"
+#include "trace.h"
+#include "memoryReport.h"
 #include <cassert>
+#include <algorithm>
 #include <utility>
+#include <sstream>
 using namespace std;
 
+/**********************************************
+ * ZOBRIST
+ *         The random numbers behind getHash(): one for each piece on each
+ *         square, one for black to move, one for each castling right, and
+ *         one for each file a pawn can be captured en passant on
+ *********************************************/
+struct Zobrist
+{
+   uint64_t piece[2][8][64];
+   uint64_t black;
+   uint64_t castle[4];
+   uint64_t enpassant[8];
+
+   Zobrist()
+   {
+      // splitmix64 from a fixed seed, so hashes are the same every run
+      uint64_t seed = 0x9E3779B97F4A7C15ull;
+      auto random = [&seed]()
+      {
+         uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+         z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+         z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+         return z ^ (z >> 31);
+      };
+      for (auto& color : piece)
+         for (auto& type : color)
+            for (uint64_t& square : type)
+               square = random();
+      black = random();
+      for (uint64_t& right : castle)
+         right = random();
+      for (uint64_t& file : enpassant)
+         file = random();
+   }
+};
+
+// made on first use, then shared by every board
+static const Zobrist& getZobrist()
+{
+   static const Zobrist zobrist;
+   return zobrist;
+}
+
+/***********************************************
+ * CREATE PIECE
+ *         Allocate a piece of the given type
+ ***********************************************/
+static Piece* createPiece(PieceType pt, int c, int r, bool isWhite)
+{
+   switch (pt)
+   {
+   case KING:   return new King(c, r, isWhite);
+   case QUEEN:  return new Queen(c, r, isWhite);
+   case ROOK:   return new Rook(c, r, isWhite);
+   case BISHOP: return new Bishop(c, r, isWhite);
+   case KNIGHT: return new Knight(c, r, isWhite);
+   case PAWN:   return new Pawn(c, r, isWhite);
+   default:     return new Space(c, r);
+   }
+}
+
+/***********************************************
+ * PIECE SIZE
+ *         The bytes of a piece of the given type
+ ***********************************************/
+static size_t pieceSize(PieceType pt)
+{
+   switch (pt)
+   {
+   case KING:   return sizeof(King);
+   case QUEEN:  return sizeof(Queen);
+   case ROOK:   return sizeof(Rook);
+   case BISHOP: return sizeof(Bishop);
+   case KNIGHT: return sizeof(Knight);
+   case PAWN:   return sizeof(Pawn);
+   default:     return sizeof(Space);
+   }
+}
+
 /***********************************************
  * BOARD : RESET
  *         Initialize the board with standard chess starting positions
@@ -64,6 +147,8 @@ void Board::reset(bool fFree)
    for (int r = 2; r < 6; r++)
       for (int c = 0; c < 8; c++)
          board[c][r] = new Space(c, r);
+
+   hash = computeHash();
 }
 
 /***********************************************
@@ -125,18 +210,41 @@ void Board::display(const Position& posHover, const Position& posSelect, const s
  * BOARD : CONSTRUCTOR
  *         Initialize an empty board and optionally reset to starting position
  ************************************************/
-Board::Board(ogstream* pgout, bool noreset) : pgout(pgout), numMoves(0)
+Board::Board(ogstream* pgout, bool noreset) : pgout(pgout), numMoves(0), hash(0)
 {
    // Initialize all board positions to null
    for (int r = 0; r < 8; r++)
       for (int c = 0; c < 8; c++)
          board[c][r] = nullptr;
+   hash = computeHash();
 
    // Set up initial chess position unless noreset is specified
    if (!noreset)
       reset();
 }
 
+/************************************************
+ * BOARD : COPY CONSTRUCTOR
+ *         A deep copy with pieces of its own, so that another thread
+ *         can search it. The history is not copied: the copy cannot
+ *         take back moves made before it was created
+ ************************************************/
+Board::Board(const Board& rhs) : pgout(rhs.pgout), numMoves(rhs.numMoves), hash(rhs.hash)
+{
+   for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+      {
+         const Piece* pPiece = rhs.board[c][r];
+         board[c][r] = nullptr;
+         if (pPiece != nullptr)
+         {
+            board[c][r] = createPiece(pPiece->getType(), c, r, pPiece->isWhite());
+            board[c][r]->nMoves = pPiece->nMoves;
+            board[c][r]->lastMove = pPiece->lastMove;
+         }
+      }
+}
+
 /************************************************
  * BOARD : FREE
  *         Deallocate all pieces and reset board to null pointers
@@ -150,6 +258,7 @@ void Board::free()
             delete board[c][r];
             board[c][r] = nullptr;
          }
+   freeSpare();
 }
 
 /**********************************************
@@ -186,65 +295,1146 @@ BoardEmpty::~BoardEmpty()
  *         Execute a chess move including special cases (castling, en passant, promotion)
  *********************************************/
 void Board::move(const Move& move)
+{
+   TRACE_SCOPE("Board::move");
+   makeMove(move);
+
+   // A plain move is never taken back, so whatever left the board is gone
+   Undo& undo = history.back();
+   delete undo.pCapture;
+   delete undo.pPromote;
+   history.pop_back();
+}
+
+/**********************************************
+ * BOARD : MAKE MOVE
+ *         Execute a move so that undoMove() can take it back. Captured
+ *         and promoted pieces are parked in the history rather than deleted
+ *********************************************/
+void Board::makeMove(const Move& move)
 {
    Position source = move.getSrc();
    Position dest = move.getDest();
+   Piece* pMover = board[source.getCol()][source.getRow()];
+
+   Undo undo;
+   undo.source = source;
+   undo.dest = dest;
+   undo.pCapture = nullptr;
+   undo.pPromote = nullptr;
+   undo.rookFrom = -1;
+   undo.rookTo = -1;
+   undo.nMoves = pMover->nMoves;
+   undo.lastMove = pMover->lastMove;
+   undo.hash = hash;
+
+   // the rights and en passant file this move may take away
+   const Zobrist& zobrist = getZobrist();
+   int rightsBefore = castleRights();
+   int fileBefore = enPassantFile();
 
    // Update piece movement tracking before incrementing move counter
-   (*this)[source].setLastMove(numMoves);
+   pMover->setLastMove(numMoves);
    numMoves++;
 
    // Handle en passant capture (captured pawn is adjacent, not at destination)
    if (move.getMoveType() == Move::MoveType::ENPASSANT)
-   {
-      if (move.getWhiteMove())
-      {
-         // White captures black pawn below destination square
-         delete board[dest.getCol()][dest.getRow() - 1];
-         board[dest.getCol()][dest.getRow() - 1] = new Space(dest.getCol(), dest.getRow() - 1);
-      }
-      else
-      {
-         // Black captures white pawn above destination square
-         delete board[dest.getCol()][dest.getRow() + 1];
-         board[dest.getCol()][dest.getRow() + 1] = new Space(dest.getCol(), dest.getRow() + 1);
-      }
-   }
+      undo.posCapture = Position(dest.getCol(), dest.getRow() + (move.getWhiteMove() ? -1 : 1));
    // Handle regular captures (piece at destination square)
    else if (move.getCapture() != SPACE)
+      undo.posCapture = dest;
+
+   // Take the captured piece off the board, leaving a space behind
+   if (undo.posCapture.isValid())
    {
-      delete board[dest.getCol()][dest.getRow()];
-      board[dest.getCol()][dest.getRow()] = new Space(dest.getCol(), dest.getRow());
+      int c = undo.posCapture.getCol();
+      int r = undo.posCapture.getRow();
+      undo.pCapture = board[c][r];
+      board[c][r] = acquire(SPACE, c, r, true);
    }
 
    // Check for pawn promotion before moving pieces
-   bool isPawnPromotion = (board[source.getCol()][source.getRow()]->getType() == PieceType::PAWN) &&
+   bool isPawnPromotion = (pMover->getType() == PieceType::PAWN) &&
                          (dest.getRow() == 0 || dest.getRow() == 7);
 
-   // Handle king-side castling (move rook from h-file to f-file)
-   if ((board[source.getCol()][source.getRow()]->getType() == PieceType::KING) &&
-       (move.getMoveType() == Move::MoveType::CASTLE_KING))
+   // Handle castling: the rook jumps over the king (h-file to f-file or a-file to d-file)
+   if (pMover->getType() == PieceType::KING)
    {
-      std::swap(board[source.getCol() + 3][source.getRow()], board[source.getCol() + 1][source.getRow()]);
-      board[source.getCol() + 1][source.getRow()]->setPosition(Position(source.getCol() + 1, source.getRow()));
+      if (move.getMoveType() == Move::MoveType::CASTLE_KING)
+      {
+         undo.rookFrom = source.getCol() + 3;
+         undo.rookTo   = source.getCol() + 1;
+      }
+      else if (move.getMoveType() == Move::MoveType::CASTLE_QUEEN)
+      {
+         undo.rookFrom = source.getCol() - 4;
+         undo.rookTo   = source.getCol() - 1;
+      }
    }
-
-   // Handle queen-side castling (move rook from a-file to d-file)
-   if ((board[source.getCol()][source.getRow()]->getType() == PieceType::KING) &&
-         (move.getMoveType() == Move::MoveType::CASTLE_QUEEN))
+   if (undo.rookFrom != -1)
    {
-      std::swap(board[source.getCol() - 4][source.getRow()], board[source.getCol() - 1][source.getRow()]);
-      board[source.getCol() - 1][source.getRow()]->setPosition(Position(source.getCol() - 1, source.getRow()));
+      std::swap(board[undo.rookFrom][source.getRow()], board[undo.rookTo][source.getRow()]);
+      board[undo.rookTo][source.getRow()]->setPosition(Position(undo.rookTo, source.getRow()));
+      board[undo.rookFrom][source.getRow()]->setPosition(Position(undo.rookFrom, source.getRow()));
    }
 
    // Execute the main piece movement
    std::swap(board[source.getCol()][source.getRow()], board[dest.getCol()][dest.getRow()]);
    board[dest.getCol()][dest.getRow()]->setPosition(dest);
+   board[source.getCol()][source.getRow()]->setPosition(source);
 
-   // Handle pawn promotion (replace pawn with queen)
+   // Handle pawn promotion (a queen unless the move asks for something else)
    if (isPawnPromotion)
    {
-      delete board[dest.getCol()][dest.getRow()];
-      board[dest.getCol()][dest.getRow()] = new Queen(dest.getCol(), dest.getRow(), move.getWhiteMove());
+      PieceType pt = move.getPromotion();
+      if (pt != ROOK && pt != BISHOP && pt != KNIGHT)
+         pt = QUEEN;
+      undo.pPromote = board[dest.getCol()][dest.getRow()];
+      board[dest.getCol()][dest.getRow()] = acquire(pt, dest.getCol(), dest.getRow(), move.getWhiteMove());
+   }
+
+   // the hash changes by what moved, what was taken, and what it did to
+   // the side to move, the castling rights and the en passant file
+   int color = pMover->isWhite() ? 1 : 0;
+   hash ^= zobrist.piece[color][pMover->getType()][source.getRow() * 8 + source.getCol()];
+   hash ^= zobrist.piece[color][board[dest.getCol()][dest.getRow()]->getType()][dest.getRow() * 8 + dest.getCol()];
+   if (undo.pCapture && undo.pCapture->getType() != SPACE)
+      hash ^= zobrist.piece[undo.pCapture->isWhite() ? 1 : 0][undo.pCapture->getType()]
+                           [undo.posCapture.getRow() * 8 + undo.posCapture.getCol()];
+   if (undo.rookFrom != -1)
+      hash ^= zobrist.piece[color][ROOK][source.getRow() * 8 + undo.rookFrom] ^
+              zobrist.piece[color][ROOK][source.getRow() * 8 + undo.rookTo];
+   hash ^= zobrist.black;
+   int rightsChanged = rightsBefore ? rightsBefore ^ castleRights() : 0;
+   for (int i = 0; i < 4; i++)
+      if (rightsChanged & (1 << i))
+         hash ^= zobrist.castle[i];
+   int fileAfter = enPassantFile();
+   if (fileBefore >= 0)
+      hash ^= zobrist.enpassant[fileBefore];
+   if (fileAfter >= 0)
+      hash ^= zobrist.enpassant[fileAfter];
+
+   history.push_back(undo);
+}
+
+/**********************************************
+ * BOARD : UNDO MOVE
+ *         Take back the most recent makeMove()
+ *********************************************/
+void Board::undoMove()
+{
+   assert(!history.empty());
+   const Undo& undo = history.back();
+   int cSrc  = undo.source.getCol();
+   int rSrc  = undo.source.getRow();
+   int cDest = undo.dest.getCol();
+   int rDest = undo.dest.getRow();
+
+   numMoves--;
+   hash = undo.hash;
+
+   // Put the pawn back in place of the piece it was promoted to
+   if (undo.pPromote)
+   {
+      release(board[cDest][rDest]);
+      board[cDest][rDest] = undo.pPromote;
+   }
+
+   // Return the mover and restore its movement tracking
+   std::swap(board[cSrc][rSrc], board[cDest][rDest]);
+   board[cSrc][rSrc]->setPosition(undo.source);
+   board[cDest][rDest]->setPosition(undo.dest);
+   board[cSrc][rSrc]->nMoves = undo.nMoves;
+   board[cSrc][rSrc]->lastMove = undo.lastMove;
+
+   // Return the castling rook
+   if (undo.rookFrom != -1)
+   {
+      std::swap(board[undo.rookFrom][rSrc], board[undo.rookTo][rSrc]);
+      board[undo.rookFrom][rSrc]->setPosition(Position(undo.rookFrom, rSrc));
+      board[undo.rookTo][rSrc]->setPosition(Position(undo.rookTo, rSrc));
+   }
+
+   // Return the captured piece
+   if (undo.pCapture)
+   {
+      int c = undo.posCapture.getCol();
+      int r = undo.posCapture.getRow();
+      release(board[c][r]);
+      board[c][r] = undo.pCapture;
+   }
+
+   history.pop_back();
+}
+
+/**********************************************
+ * BOARD : GET MOVES
+ *         Every legal move for the side to move: the pseudo-legal
+ *         moves from each piece that do not leave our king in check
+ *********************************************/
+void Board::getMoves(vector<Move>& moves)
+{
+   bool white = whiteTurn();
+   set<Move> possible;
+
+   moves.clear();
+   for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+      {
+         const Piece* pPiece = board[c][r];
+         if (pPiece == nullptr || pPiece->getType() == SPACE || pPiece->isWhite() != white)
+            continue;
+
+         possible.clear();
+         pPiece->getMoves(possible, *this);
+         for (const Move& move : possible)
+         {
+            makeMove(move);
+            if (!inCheck(white))
+               moves.push_back(move);
+            undoMove();
+         }
+      }
+}
+
+/**********************************************
+ * BOARD : GENERATE MOVES
+ *         The same moves as getMoves(), from forEachLegal() rather
+ *         than the pieces, so nothing is made, taken back, or put in a set
+ *********************************************/
+void Board::generateMoves(vector<Move>& moves)
+{
+   generate(moves, false /*tactical*/);
+}
+
+/**********************************************
+ * BOARD : GENERATE CAPTURES
+ *         Only the legal captures, en passant, and promotions. The quiet
+ *         moves are never visited, so this is not generateMoves() filtered
+ *********************************************/
+void Board::generateCaptures(vector<Move>& moves)
+{
+   generate(moves, true /*tactical*/);
+}
+
+/**********************************************
+ * BOARD : GENERATE
+ *         Build a Move for each move forEachLegal() visits
+ *********************************************/
+void Board::generate(vector<Move>& moves, bool tactical)
+{
+   moves.clear();
+   bool white = whiteTurn();
+   forEachLegal([&](int cFrom, int rFrom, int cTo, int rTo, Move::MoveType type, PieceType promote)
+   {
+      Move move;
+      move.setSrc(Position(cFrom, rFrom));
+      move.setDest(Position(cTo, rTo));
+      move.setWhiteMove(white);
+      move.setCapture(board[cTo][rTo]->getType());
+      if (promote != SPACE)
+         move.setPromotion(promote);
+      if (type == Move::ENPASSANT)
+      {
+         move.setEnPassant();
+         move.setCapture(PAWN);
+      }
+      else if (type == Move::CASTLE_KING)
+         move.setCastle(true);
+      else if (type == Move::CASTLE_QUEEN)
+         move.setCastleQ();
+      moves.push_back(move);
+   }, tactical);
+}
+
+/**********************************************
+ * BOARD : COUNT MOVES
+ *         The number of legal moves for the side to move. This agrees
+ *         with getMoves().size() but never builds a Move or makes a move
+ *********************************************/
+int Board::countMoves()
+{
+   int count = 0;
+   forEachLegal([&](int, int, int, int, Move::MoveType, PieceType) { count++; });
+   return count;
+}
+
+/**********************************************
+ * BOARD : FOR EACH LEGAL
+ *         Call visit(cFrom, rFrom, cTo, rTo, moveType, promote) for every
+ *         legal move of the side to move. The rules mirror the getMoves()
+ *         of each piece, working on the squares directly instead of sets.
+ *         When tactical, only captures and promotions are visited
+ *********************************************/
+template <class Visit>
+void Board::forEachLegal(Visit visit, bool tactical)
+{
+   static const Delta knight[] =
+   {
+      { 2, -1 }, { 2, 1 }, { 1, -2 }, { 1, 2 }, { -1, -2 }, { -1, 2 }, { -2, -1 }, { -2, 1 }
+   };
+   static const Delta king[] =
+   {
+      { 1, -1 }, { 1, 0 }, { 1, 1 }, { 0, -1 }, { 0, 1 }, { -1, -1 }, { -1, 0 }, { -1, 1 }
+   };
+   static const Delta orthogonal[] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+   static const Delta diagonal[]   = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+   bool white = whiteTurn();
+
+   // find our king, since every move is checked against it
+   int cKing = -1;
+   int rKing = -1;
+   for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+         if (board[c][r]->getType() == KING && board[c][r]->isWhite() == white)
+         {
+            cKing = c;
+            rKing = r;
+         }
+
+   auto onBoard = [](int c, int r) { return c >= 0 && c < 8 && r >= 0 && r < 8; };
+   auto isEmpty = [&](int c, int r) { return board[c][r]->getType() == SPACE; };
+   auto isEnemy = [&](int c, int r)
+   {
+      return board[c][r]->getType() != SPACE && board[c][r]->isWhite() != white;
+   };
+
+   // report the move if it does not leave our king in check
+   auto tryMove = [&](int cFrom, int rFrom, int cTo, int rTo, Move::MoveType type,
+                      int cCapture, int rCapture)
+   {
+      bool isKing = (cFrom == cKing && rFrom == rKing);
+      if (isLegal(cFrom, rFrom, cTo, rTo, cCapture, rCapture,
+                  isKing ? cTo : cKing, isKing ? rTo : rKing))
+         visit(cFrom, rFrom, cTo, rTo, type, SPACE);
+   };
+
+   // a pawn reaching the last rank is one move for each promotion
+   auto tryPawn = [&](int cFrom, int rFrom, int cTo, int rTo)
+   {
+      if (rTo != 0 && rTo != 7)
+         tryMove(cFrom, rFrom, cTo, rTo, Move::MOVE, -1, -1);
+      else if (isLegal(cFrom, rFrom, cTo, rTo, -1, -1, cKing, rKing))
+         for (PieceType pt : { QUEEN, ROOK, BISHOP, KNIGHT })
+            visit(cFrom, rFrom, cTo, rTo, Move::MOVE, pt);
+   };
+
+   // single steps (knight and king) and slides (bishop, rook, queen)
+   auto steps = [&](int c, int r, const Delta deltas[], int num)
+   {
+      for (int i = 0; i < num; i++)
+      {
+         int cTo = c + deltas[i].dCol;
+         int rTo = r + deltas[i].dRow;
+         if (onBoard(cTo, rTo) && ((!tactical && isEmpty(cTo, rTo)) || isEnemy(cTo, rTo)))
+            tryMove(c, r, cTo, rTo, Move::MOVE, -1, -1);
+      }
+   };
+   auto slides = [&](int c, int r, const Delta deltas[], int num)
+   {
+      for (int i = 0; i < num; i++)
+      {
+         int cTo = c + deltas[i].dCol;
+         int rTo = r + deltas[i].dRow;
+         while (onBoard(cTo, rTo) && isEmpty(cTo, rTo))
+         {
+            if (!tactical)
+               tryMove(c, r, cTo, rTo, Move::MOVE, -1, -1);
+            cTo += deltas[i].dCol;
+            rTo += deltas[i].dRow;
+         }
+         if (onBoard(cTo, rTo) && isEnemy(cTo, rTo))
+            tryMove(c, r, cTo, rTo, Move::MOVE, -1, -1);
+      }
+   };
+
+   for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+      {
+         const Piece* pPiece = board[c][r];
+         if (pPiece->getType() == SPACE || pPiece->isWhite() != white)
+            continue;
+
+         switch (pPiece->getType())
+         {
+         case KNIGHT:
+            steps(c, r, knight, 8);
+            break;
+         case BISHOP:
+            slides(c, r, diagonal, 4);
+            break;
+         case ROOK:
+            slides(c, r, orthogonal, 4);
+            break;
+         case QUEEN:
+            slides(c, r, diagonal, 4);
+            slides(c, r, orthogonal, 4);
+            break;
+         case KING:
+            steps(c, r, king, 8);
+
+            // castling: neither king nor rook has moved, the way is clear,
+            // and the king is not in check nor passes through an attack
+            if (!tactical && pPiece->nMoves == 0 && c == 4 && r == (white ? 0 : 7) &&
+                !isAttacked(Position(c, r), !white))
+            {
+               const Piece* pRook = board[7][r];
+               if (pRook->getType() == ROOK && pRook->isWhite() == white && pRook->nMoves == 0 &&
+                   isEmpty(5, r) && isEmpty(6, r) && !isAttacked(Position(5, r), !white))
+                  tryMove(c, r, 6, r, Move::CASTLE_KING, -1, -1);
+               pRook = board[0][r];
+               if (pRook->getType() == ROOK && pRook->isWhite() == white && pRook->nMoves == 0 &&
+                   isEmpty(1, r) && isEmpty(2, r) && isEmpty(3, r) &&
+                   !isAttacked(Position(3, r), !white))
+                  tryMove(c, r, 2, r, Move::CASTLE_QUEEN, -1, -1);
+            }
+            break;
+         case PAWN:
+         {
+            int dRow = white ? 1 : -1;
+            int rTo = r + dRow;
+            if (!onBoard(c, rTo))
+               break;
+
+            // forward one, then two if the pawn has never moved. Of
+            // these, only a promotion is tactical
+            if (isEmpty(c, rTo))
+            {
+               if (!tactical || rTo == 0 || rTo == 7)
+                  tryPawn(c, r, c, rTo);
+               if (!tactical && pPiece->nMoves == 0 && onBoard(c, rTo + dRow) && isEmpty(c, rTo + dRow))
+                  tryMove(c, r, c, rTo + dRow, Move::MOVE, -1, -1);
+            }
+
+            for (int cTo = c - 1; cTo <= c + 1; cTo += 2)
+            {
+               if (!onBoard(cTo, rTo))
+                  continue;
+
+               // diagonal captures
+               if (isEnemy(cTo, rTo))
+                  tryPawn(c, r, cTo, rTo);
+
+               // en passant, from our fifth rank, of a pawn that just made its first move
+               const Piece* pAdjacent = board[cTo][r];
+               if (r == (white ? 4 : 3) && pAdjacent->getType() == PAWN && pAdjacent->isWhite() != white &&
+                   pAdjacent->nMoves == 1 && pAdjacent->lastMove == numMoves - 1 &&
+                   isEmpty(cTo, rTo))
+                  tryMove(c, r, cTo, rTo, Move::ENPASSANT, cTo, r);
+            }
+            break;
+         }
+         default:
+            break;
+         }
+      }
+}
+
+/**********************************************
+ * BOARD : IS LEGAL
+ *         Would our king on (cKing, rKing) be safe after moving the piece
+ *         on the from square to the to square? The squares are changed
+ *         just long enough to ask isAttacked() and then put back
+ *********************************************/
+bool Board::isLegal(int cFrom, int rFrom, int cTo, int rTo,
+                    int cCapture, int rCapture, int cKing, int rKing)
+{
+   static Space empty(0, 0);
+
+   bool white = board[cFrom][rFrom]->isWhite();
+   Piece* pFrom = board[cFrom][rFrom];
+   Piece* pTo   = board[cTo][rTo];
+   Piece* pCapture = (cCapture >= 0) ? board[cCapture][rCapture] : nullptr;
+
+   board[cTo][rTo] = pFrom;
+   board[cFrom][rFrom] = &empty;
+   if (pCapture)
+      board[cCapture][rCapture] = &empty;
+
+   bool legal = cKing < 0 || !isAttacked(Position(cKing, rKing), !white);
+
+   if (pCapture)
+      board[cCapture][rCapture] = pCapture;
+   board[cFrom][rFrom] = pFrom;
+   board[cTo][rTo] = pTo;
+
+   return legal;
+}
+
+/**********************************************
+ * BOARD : IS ATTACKED
+ *         Is the given square attacked by a piece of the given color?
+ *********************************************/
+bool Board::isAttacked(const Position& pos, bool byWhite) const
+{
+   static const Delta knight[] =
+   {
+      { 2, -1 }, { 2, 1 }, { 1, -2 }, { 1, 2 }, { -1, -2 }, { -1, 2 }, { -2, -1 }, { -2, 1 }
+   };
+   static const Delta king[] =
+   {
+      { 1, -1 }, { 1, 0 }, { 1, 1 }, { 0, -1 }, { 0, 1 }, { -1, -1 }, { -1, 0 }, { -1, 1 }
+   };
+   static const Delta orthogonal[] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+   static const Delta diagonal[]   = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+   int col = pos.getCol();
+   int row = pos.getRow();
+
+   // the piece on a square if it is an attacker of the right color
+   auto attacker = [&](int c, int r) -> PieceType
+   {
+      if (c < 0 || c > 7 || r < 0 || r > 7)
+         return INVALID;
+      if (board[c][r] == nullptr)
+         return SPACE;
+      PieceType pt = board[c][r]->getType();
+      if (pt == SPACE || board[c][r]->isWhite() != byWhite)
+         return pt == SPACE ? SPACE : INVALID;
+      return pt;
+   };
+
+   // pawns attack diagonally forward, so look diagonally backward for them
+   int rowPawn = byWhite ? row - 1 : row + 1;
+   if (attacker(col - 1, rowPawn) == PAWN || attacker(col + 1, rowPawn) == PAWN)
+      return true;
+
+   for (const Delta& d : knight)
+      if (attacker(col + d.dCol, row + d.dRow) == KNIGHT)
+         return true;
+
+   for (const Delta& d : king)
+      if (attacker(col + d.dCol, row + d.dRow) == KING)
+         return true;
+
+   // sliders: walk each ray until something blocks it
+   for (const Delta& d : orthogonal)
+   {
+      int c = col + d.dCol;
+      int r = row + d.dRow;
+      PieceType pt;
+      while ((pt = attacker(c, r)) == SPACE)
+      {
+         c += d.dCol;
+         r += d.dRow;
+      }
+      if (pt == ROOK || pt == QUEEN)
+         return true;
+   }
+   for (const Delta& d : diagonal)
+   {
+      int c = col + d.dCol;
+      int r = row + d.dRow;
+      PieceType pt;
+      while ((pt = attacker(c, r)) == SPACE)
+      {
+         c += d.dCol;
+         r += d.dRow;
+      }
+      if (pt == BISHOP || pt == QUEEN)
+         return true;
+   }
+
+   return false;
+}
+
+/**********************************************
+ * BOARD : IN CHECK
+ *         Is the king of the given color attacked?
+ *********************************************/
+bool Board::inCheck(bool white) const
+{
+   for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+         if (board[c][r] != nullptr && board[c][r]->getType() == KING &&
+             board[c][r]->isWhite() == white)
+            return isAttacked(Position(c, r), !white);
+   return false;
+}
+
+/**********************************************
+ * SEE VALUE
+ *         What each piece is worth in an exchange, by PieceType. The
+ *         king is worth more than everything else together, so an
+ *         exchange never ends with it captured
+ *********************************************/
+static const int SEE_VALUE[8] = { 0, 0, 20000, 900, 500, 330, 320, 100 };
+
+/**********************************************
+ * BOARD : LEAST ATTACKER
+ *         The cheapest piece of the given color that attacks the square,
+ *         ignoring the squares set in removed (bit c * 8 + r). Those are
+ *         pieces already traded off, so a slider behind one now attacks
+ *         through it. Returns SPACE if there is none
+ *********************************************/
+PieceType Board::leastAttacker(int col, int row, bool byWhite, uint64_t removed,
+                               int& cFrom, int& rFrom) const
+{
+   static const Delta knight[] =
+   {
+      { 2, -1 }, { 2, 1 }, { 1, -2 }, { 1, 2 }, { -1, -2 }, { -1, 2 }, { -2, -1 }, { -2, 1 }
+   };
+   static const Delta king[] =
+   {
+      { 1, -1 }, { 1, 0 }, { 1, 1 }, { 0, -1 }, { 0, 1 }, { -1, -1 }, { -1, 0 }, { -1, 1 }
+   };
+   static const Delta orthogonal[] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+   static const Delta diagonal[]   = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+   // the piece on a square unless it is off the board or traded off
+   auto at = [&](int c, int r) -> PieceType
+   {
+      if (c < 0 || c > 7 || r < 0 || r > 7)
+         return INVALID;
+      if (removed & (1ULL << (c * 8 + r)))
+         return SPACE;
+      return board[c][r]->getType();
+   };
+   auto ours = [&](int c, int r) { return board[c][r]->isWhite() == byWhite; };
+
+   // pawns attack diagonally forward, so look diagonally backward for them
+   int rowPawn = byWhite ? row - 1 : row + 1;
+   for (int c = col - 1; c <= col + 1; c += 2)
+      if (at(c, rowPawn) == PAWN && ours(c, rowPawn))
+      {
+         cFrom = c;
+         rFrom = rowPawn;
+         return PAWN;
+      }
+
+   for (const Delta& d : knight)
+      if (at(col + d.dCol, row + d.dRow) == KNIGHT && ours(col + d.dCol, row + d.dRow))
+      {
+         cFrom = col + d.dCol;
+         rFrom = row + d.dRow;
+         return KNIGHT;
+      }
+
+   // the nearest piece on each ray, keeping the cheapest slider of ours
+   PieceType best = SPACE;
+   auto slide = [&](const Delta deltas[], PieceType slider)
+   {
+      for (int i = 0; i < 4; i++)
+      {
+         int c = col + deltas[i].dCol;
+         int r = row + deltas[i].dRow;
+         PieceType pt;
+         while ((pt = at(c, r)) == SPACE)
+         {
+            c += deltas[i].dCol;
+            r += deltas[i].dRow;
+         }
+         if ((pt == slider || pt == QUEEN) && ours(c, r) &&
+             (best == SPACE || SEE_VALUE[pt] < SEE_VALUE[best]))
+         {
+            best = pt;
+            cFrom = c;
+            rFrom = r;
+         }
+      }
+   };
+   slide(diagonal, BISHOP);
+   if (best == BISHOP)
+      return BISHOP;
+   slide(orthogonal, ROOK);
+   if (best != SPACE)
+      return best;
+
+   for (const Delta& d : king)
+      if (at(col + d.dCol, row + d.dRow) == KING && ours(col + d.dCol, row + d.dRow))
+      {
+         cFrom = col + d.dCol;
+         rFrom = row + d.dRow;
+         return KING;
+      }
+   return SPACE;
+}
+
+/**********************************************
+ * BOARD : SEE
+ *         Static exchange evaluation: the material the side to move wins
+ *         or loses by playing the move and then trading on its
+ *         destination, each side recapturing with its cheapest piece and
+ *         free to stop when going on would lose more. Nothing is moved;
+ *         the pieces traded off are only marked. Pins are not considered
+ *********************************************/
+int Board::see(const Move& move) const
+{
+   int cFrom = move.getSrc().getCol();
+   int rFrom = move.getSrc().getRow();
+   int cTo = move.getDest().getCol();
+   int rTo = move.getDest().getRow();
+   bool white = board[cFrom][rFrom]->isWhite();
+   PieceType mover = board[cFrom][rFrom]->getType();
+   uint64_t removed = 1ULL << (cFrom * 8 + rFrom);
+
+   // gain[d] is what the side making capture d wins if both sides
+   // trade on from there
+   int gain[32];
+   gain[0] = SEE_VALUE[board[cTo][rTo]->getType()];
+   if (mover == PAWN && cFrom != cTo && board[cTo][rTo]->getType() == SPACE)
+   {
+      gain[0] = SEE_VALUE[PAWN];
+      removed |= 1ULL << (cTo * 8 + rFrom);
+   }
+   int onSquare = SEE_VALUE[mover];
+   if (move.getPromotion() != SPACE && move.getPromotion() != INVALID)
+   {
+      gain[0] += SEE_VALUE[move.getPromotion()] - SEE_VALUE[PAWN];
+      onSquare = SEE_VALUE[move.getPromotion()];
+   }
+
+   int d = 0;
+   bool side = !white;
+   int c;
+   int r;
+   PieceType pt;
+   while (d < 31 && (pt = leastAttacker(cTo, rTo, side, removed, c, r)) != SPACE)
+   {
+      d++;
+      gain[d] = onSquare - gain[d - 1];
+      if (max(-gain[d - 1], gain[d]) < 0)
+         break;
+      onSquare = SEE_VALUE[pt];
+      removed |= 1ULL << (c * 8 + r);
+      side = !side;
+   }
+
+   // each side stops trading where going on would lose more
+   for (; d > 0; d--)
+      gain[d - 1] = -max(-gain[d - 1], gain[d]);
+   return gain[0];
+}
+
+/**********************************************
+ * BOARD : SEE GE
+ *         Does the move win at least threshold in the exchange? The same
+ *         answer as see(move) >= threshold, but it stops as soon as the
+ *         answer is known rather than resolving every capture
+ *********************************************/
+bool Board::seeGE(const Move& move, int threshold) const
+{
+   int cFrom = move.getSrc().getCol();
+   int rFrom = move.getSrc().getRow();
+   int cTo = move.getDest().getCol();
+   int rTo = move.getDest().getRow();
+   bool white = board[cFrom][rFrom]->isWhite();
+   PieceType mover = board[cFrom][rFrom]->getType();
+   uint64_t removed = 1ULL << (cFrom * 8 + rFrom);
+
+   int captured = SEE_VALUE[board[cTo][rTo]->getType()];
+   if (mover == PAWN && cFrom != cTo && board[cTo][rTo]->getType() == SPACE)
+   {
+      captured = SEE_VALUE[PAWN];
+      removed |= 1ULL << (cTo * 8 + rFrom);
+   }
+   int onSquare = SEE_VALUE[mover];
+   if (move.getPromotion() != SPACE && move.getPromotion() != INVALID)
+   {
+      captured += SEE_VALUE[move.getPromotion()] - SEE_VALUE[PAWN];
+      onSquare = SEE_VALUE[move.getPromotion()];
+   }
+
+   // not enough even if the piece is never taken back
+   int balance = captured - threshold;
+   if (balance < 0)
+      return false;
+
+   // enough even if it is taken back for nothing
+   balance = onSquare - balance;
+   if (balance <= 0)
+      return true;
+
+   // balance is what the side to capture next must win to change
+   // the answer; ok is the answer if it cannot
+   bool side = !white;
+   bool ok = true;
+   int c;
+   int r;
+   PieceType pt;
+   while ((pt = leastAttacker(cTo, rTo, side, removed, c, r)) != SPACE)
+   {
+      // a king may only take if the other side cannot take back
+      if (pt == KING)
+      {
+         int cOther;
+         int rOther;
+         if (leastAttacker(cTo, rTo, !side, removed | (1ULL << (c * 8 + r)), cOther, rOther) != SPACE)
+            return ok;
+         return !ok;
+      }
+
+      ok = !ok;
+      balance = SEE_VALUE[pt] - balance;
+      if (balance < (ok ? 1 : 0))
+         break;
+      removed |= 1ULL << (c * 8 + r);
+      side = !side;
+   }
+   return ok;
+}
+
+/**********************************************
+ * BOARD : READ FEN
+ *         Set up the board from Forsyth-Edwards Notation such as
+ *         "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1".
+ *         The board has no castling or en passant flags, so those
+ *         fields become the move counts of the pieces they describe
+ *********************************************/
+void Board::readFEN(const string& fen)
+{
+   istringstream sin(fen);
+   string placement;
+   string side = "w";
+   string castle = "-";
+   string enpassant = "-";
+   int halfMove = 0;
+   int fullMove = 1;
+   sin >> placement >> side >> castle >> enpassant >> halfMove >> fullMove;
+
+   free();
+   for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+         board[c][r] = new Space(c, r);
+
+   // piece placement, from the 8th rank down to the 1st
+   int c = 0;
+   int r = 7;
+   for (char letter : placement)
+   {
+      if (letter == '/')
+      {
+         c = 0;
+         r--;
+      }
+      else if (isdigit(letter))
+         c += letter - '0';
+      else if (c < 8 && r >= 0)
+      {
+         PieceType pt = INVALID;
+         switch (tolower(letter))
+         {
+         case 'p': pt = PAWN;   break;
+         case 'n': pt = KNIGHT; break;
+         case 'b': pt = BISHOP; break;
+         case 'r': pt = ROOK;   break;
+         case 'q': pt = QUEEN;  break;
+         case 'k': pt = KING;   break;
+         }
+         if (pt != INVALID)
+         {
+            delete board[c][r];
+            board[c][r] = createPiece(pt, c, r, isupper(letter) != 0);
+         }
+         c++;
+      }
+   }
+
+   numMoves = 2 * (fullMove > 0 ? fullMove - 1 : 0) + (side == "b" ? 1 : 0);
+
+   // Nothing has moved as far as we know, except pawns off their home
+   // rank. lastMove of -2 means no piece has "just moved".
+   for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+      {
+         Piece* pPiece = board[c][r];
+         pPiece->lastMove = -2;
+         pPiece->nMoves = 0;
+         if (pPiece->getType() == PAWN && r != (pPiece->isWhite() ? 1 : 6))
+            pPiece->nMoves = 1;
+      }
+
+   // a king or rook without a castling right must have moved
+   auto castling = [&](int c, int r, PieceType pt, bool white, bool right)
+   {
+      Piece* pPiece = board[c][r];
+      if (!right && pPiece->getType() == pt && pPiece->isWhite() == white)
+         pPiece->nMoves = 1;
+   };
+   bool has[4] = { castle.find('K') != string::npos, castle.find('Q') != string::npos,
+                   castle.find('k') != string::npos, castle.find('q') != string::npos };
+   castling(7, 0, ROOK, true,  has[0]);
+   castling(0, 0, ROOK, true,  has[1]);
+   castling(4, 0, KING, true,  has[0] || has[1]);
+   castling(7, 7, ROOK, false, has[2]);
+   castling(0, 7, ROOK, false, has[3]);
+   castling(4, 7, KING, false, has[2] || has[3]);
+
+   // the pawn that can be captured en passant just made its double move
+   Position posEnPassant(enpassant.c_str());
+   if (posEnPassant.isValid())
+   {
+      int rPawn = posEnPassant.getRow() == 2 ? 3 : 4;
+      Piece* pPawn = board[posEnPassant.getCol()][rPawn];
+      if (pPawn->getType() == PAWN)
+      {
+         pPawn->nMoves = 1;
+         pPawn->lastMove = numMoves - 1;
+      }
+   }
+
+   hash = computeHash();
+}
+
+/**********************************************
+ * BOARD : GET FEN
+ *         Describe the board in Forsyth-Edwards Notation
+ *********************************************/
+string Board::getFEN() const
+{
+   const char letters[] = " ?kqrbnp";
+   string fen;
+
+   // piece placement, from the 8th rank down to the 1st
+   for (int r = 7; r >= 0; r--)
+   {
+      int empty = 0;
+      for (int c = 0; c < 8; c++)
+      {
+         const Piece* pPiece = board[c][r];
+         if (pPiece == nullptr || pPiece->getType() == SPACE)
+         {
+            empty++;
+            continue;
+         }
+         if (empty)
+            fen += (char)('0' + empty);
+         empty = 0;
+         char letter = letters[pPiece->getType()];
+         fen += pPiece->isWhite() ? (char)toupper(letter) : letter;
+      }
+      if (empty)
+         fen += (char)('0' + empty);
+      if (r)
+         fen += '/';
+   }
+
+   fen += whiteTurn() ? " w " : " b ";
+
+   // castling rights come from the king and rooks that have not moved
+   auto unmoved = [&](int c, int r, PieceType pt, bool white)
+   {
+      const Piece* pPiece = board[c][r];
+      return pPiece != nullptr && pPiece->getType() == pt &&
+             pPiece->isWhite() == white && pPiece->nMoves == 0;
+   };
+   string castle;
+   if (unmoved(4, 0, KING, true))
+   {
+      if (unmoved(7, 0, ROOK, true)) castle += 'K';
+      if (unmoved(0, 0, ROOK, true)) castle += 'Q';
+   }
+   if (unmoved(4, 7, KING, false))
+   {
+      if (unmoved(7, 7, ROOK, false)) castle += 'k';
+      if (unmoved(0, 7, ROOK, false)) castle += 'q';
+   }
+   fen += castle.empty() ? "-" : castle;
+
+   // en passant is possible behind a pawn that just made its double move
+   string enpassant = "-";
+   int rPawn = whiteTurn() ? 4 : 3;
+   for (int c = 0; c < 8; c++)
+   {
+      const Piece* pPiece = board[c][rPawn];
+      if (pPiece != nullptr && pPiece->getType() == PAWN &&
+          pPiece->isWhite() != whiteTurn() && pPiece->nMoves == 1 &&
+          pPiece->lastMove == numMoves - 1)
+      {
+         enpassant = "";
+         enpassant += (char)('a' + c);
+         enpassant += whiteTurn() ? '6' : '3';
+      }
+   }
+   fen += " " + enpassant;
+
+   fen += " 0 " + to_string(numMoves / 2 + 1);
+   return fen;
+}
+
+/**********************************************
+ * BOARD : COMPUTE HASH
+ *         Zobrist hash of the pieces, the side to move, the castling
+ *         rights and the en passant file, all as the move generators
+ *         see them, from scratch. makeMove() and undoMove() keep hash
+ *         equal to this without looking at every square
+ *********************************************/
+uint64_t Board::computeHash() const
+{
+   const Zobrist& zobrist = getZobrist();
+   uint64_t hash = whiteTurn() ? 0 : zobrist.black;
+
+   for (int r = 0; r < 8; r++)
+      for (int c = 0; c < 8; c++)
+      {
+         const Piece* pPiece = board[c][r];
+         if (pPiece != nullptr && pPiece->getType() != SPACE)
+            hash ^= zobrist.piece[pPiece->isWhite() ? 1 : 0][pPiece->getType()][r * 8 + c];
+      }
+
+   int rights = castleRights();
+   for (int i = 0; i < 4; i++)
+      if (rights & (1 << i))
+         hash ^= zobrist.castle[i];
+
+   int file = enPassantFile();
+   if (file >= 0)
+      hash ^= zobrist.enpassant[file];
+   return hash;
+}
+
+/**********************************************
+ * BOARD : CASTLE RIGHTS
+ *         One bit for each castle whose king and rook have not moved:
+ *         white king-side, white queen-side, black king-side, then
+ *         black queen-side
+ *********************************************/
+int Board::castleRights() const
+{
+   auto unmoved = [&](int c, int r, PieceType pt, bool white)
+   {
+      const Piece* pPiece = board[c][r];
+      return pPiece != nullptr && pPiece->getType() == pt &&
+             pPiece->isWhite() == white && pPiece->nMoves == 0;
+   };
+   int rights = 0;
+   if (unmoved(4, 0, KING, true))
+   {
+      if (unmoved(7, 0, ROOK, true)) rights |= 1;
+      if (unmoved(0, 0, ROOK, true)) rights |= 2;
+   }
+   if (unmoved(4, 7, KING, false))
+   {
+      if (unmoved(7, 7, ROOK, false)) rights |= 4;
+      if (unmoved(0, 7, ROOK, false)) rights |= 8;
+   }
+   return rights;
+}
+
+/**********************************************
+ * BOARD : EN PASSANT FILE
+ *         The file of the pawn that just made its double first move,
+ *         which the side to move may take en passant, or -1
+ *********************************************/
+int Board::enPassantFile() const
+{
+   bool white = whiteTurn();
+   int r = white ? 4 : 3;
+   for (int c = 0; c < 8; c++)
+   {
+      const Piece* pPiece = board[c][r];
+      if (pPiece != nullptr && pPiece->getType() == PAWN && pPiece->isWhite() != white &&
+          pPiece->nMoves == 1 && pPiece->lastMove == numMoves - 1)
+         return c;
+   }
+   return -1;
+}
+
+/**********************************************
+ * BOARD : ACQUIRE
+ *         A piece to put on the board, reusing a spare if we have one
+ *********************************************/
+Piece* Board::acquire(PieceType pt, int c, int r, bool isWhite)
+{
+   vector<Piece*>& pool = spare[isWhite ? 1 : 0][pt];
+   if (pool.empty())
+      return createPiece(pt, c, r, isWhite);
+
+   Piece* pPiece = pool.back();
+   pool.pop_back();
+   pPiece->position.set(c, r);
+   pPiece->nMoves = 0;
+   pPiece->lastMove = 0;
+   return pPiece;
+}
+
+/**********************************************
+ * BOARD : RELEASE
+ *         Keep a piece that came off the board for later reuse
+ *********************************************/
+void Board::release(Piece* pPiece)
+{
+   PieceType pt = pPiece->getType();
+   spare[pt == SPACE || pPiece->isWhite() ? 1 : 0][pt].push_back(pPiece);
+}
+
+/**********************************************
+ * BOARD : FREE SPARE
+ *         Delete the spare pieces and anything parked in the history
+ *********************************************/
+void Board::freeSpare()
+{
+   for (const Undo& undo : history)
+   {
+      delete undo.pCapture;
+      delete undo.pPromote;
+   }
+   history.clear();
+
+   for (auto& color : spare)
+      for (auto& pool : color)
+      {
+         for (Piece* pPiece : pool)
+            delete pPiece;
+         pool.clear();
+      }
+}
+
+/***********************************************
+ * BOARD : MEMORY REPORT
+ *         Every square holds its own heap piece, the empty ones
+ *         included. The spare pieces and the history grow with
+ *         use and are not given back until the board is freed
+ ***********************************************/
+void Board::memoryReport(MemoryReport& report) const
+{
+   report.add("Board", "Board", 1, sizeof(Board));
+
+   size_t numPieces = 0;
+   size_t bytesPieces = 0;
+   size_t numSpaces = 0;
+   size_t bytesSpaces = 0;
+   for (int c = 0; c < 8; c++)
+      for (int r = 0; r < 8; r++)
+      {
+         if (board[c][r] == nullptr)
+            continue;
+         PieceType pt = board[c][r]->getType();
+         if (pt == SPACE)
+         {
+            numSpaces++;
+            bytesSpaces += pieceSize(pt);
+         }
+         else
+         {
+            numPieces++;
+            bytesPieces += pieceSize(pt);
+         }
+      }
+   report.add("Board", "Pieces", numPieces, bytesPieces);
+   report.add("Board", "Spaces", numSpaces, bytesSpaces);
+
+   size_t numSpare = 0;
+   size_t bytesSpare = 0;
+   for (int color = 0; color < 2; color++)
+      for (int pt = 0; pt < 8; pt++)
+      {
+         numSpare += spare[color][pt].size();
+         bytesSpare += spare[color][pt].capacity() * sizeof(Piece*) +
+                       spare[color][pt].size() * pieceSize((PieceType)pt);
+      }
+   report.add("Board", "Spare pieces", numSpare, bytesSpare);
+
+   // each entry may park a captured piece and a promoted pawn
+   size_t bytesHistory = history.capacity() * sizeof(Undo);
+   for (const Undo& undo : history)
+   {
+      if (undo.pCapture)
+         bytesHistory += pieceSize(undo.pCapture->getType());
+      if (undo.pPromote)
+         bytesHistory += pieceSize(PAWN);
    }
+   report.add("History", "Undo entries", history.size(), bytesHistory);
 }
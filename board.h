@@ -12,10 +12,12 @@
 #include <stack>
 #include <cassert>
 #include <set>
+#include <vector>
 #include "move.h"
 #include "pieceSpace.h"
 
 using std::set;
+using std::vector;
 
 class ogstream;
 class TestPawn;
@@ -27,6 +29,13 @@ class TestKing;
 class TestBoard;
 class Position;
 class Piece;
+class MemoryReport;
+class Search;
+class SplitSearch;
+class MoveOrder;
+
+// the standard starting position in Forsyth-Edwards Notation
+const char FEN_INITIAL[] = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
 
 
 /***************************************************
@@ -42,11 +51,16 @@ class Board
    friend TestQueen;
    friend TestKing;
    friend TestBoard;
+   friend Search;
+   friend SplitSearch;
+   friend MoveOrder;
 public:
 
    // create and destroy the board
    Board(ogstream* pgout = nullptr, bool noreset = false);
-   virtual ~Board() {}
+   Board(const Board& rhs);
+   virtual ~Board() { freeSpare(); }
+   Board& operator = (const Board& rhs) = delete;
 
    // getters
    virtual int  getCurrentMove() const { return numMoves; }
@@ -60,11 +74,72 @@ public:
    virtual void move(const Move& move);
    virtual Piece& operator [] (const Position& pos);
 
+   // reversible moves so the board can be searched
+   void makeMove(const Move& move);
+   void undoMove();
+
+   // legal moves and check detection for the side to move
+   void getMoves(vector<Move>& moves);
+   void generateMoves(vector<Move>& moves);
+   void generateCaptures(vector<Move>& moves);   // and promotions
+   int  countMoves();
+   bool isAttacked(const Position& pos, bool byWhite) const;
+   bool inCheck(bool white) const;
+
+   // static exchange evaluation: what the move wins or loses in the
+   // trades on its destination, in centipawns, and whether that is at
+   // least threshold
+   int  see(const Move& move) const;
+   bool seeGE(const Move& move, int threshold) const;
+
+   // Forsyth-Edwards Notation
+   void   readFEN(const string& fen);
+   string getFEN() const;
+
+   // Zobrist hash of everything that decides the legal moves. makeMove()
+   // and undoMove() keep it up to date; computeHash() starts from scratch
+   uint64_t getHash() const { return hash; }
+   uint64_t computeHash() const;
+
+   // the board, its pieces, the spare pieces, and the history
+   void memoryReport(MemoryReport& report) const;
+
 protected:
    void  assertBoard();
+   Piece* acquire(PieceType pt, int c, int r, bool isWhite);
+   void   release(Piece* pPiece);
+   void   freeSpare();
+   void   generate(vector<Move>& moves, bool tactical);
+   template <class Visit>
+   void   forEachLegal(Visit visit, bool tactical = false);
+   bool   isLegal(int cFrom, int rFrom, int cTo, int rTo,
+                  int cCapture, int rCapture, int cKing, int rKing);
+   PieceType leastAttacker(int col, int row, bool byWhite, uint64_t removed,
+                           int& cFrom, int& rFrom) const;
+   int    castleRights() const;
+   int    enPassantFile() const;
+
+   // everything needed to take back one makeMove()
+   struct Undo
+   {
+      Position source;      // where the mover started
+      Position dest;        // where the mover finished
+      Position posCapture;  // where the captured piece stood
+      Piece*   pCapture;    // the captured piece, parked until undone
+      Piece*   pPromote;    // the promoted pawn, parked until undone
+      int      rookFrom;    // column the castling rook left, or -1
+      int      rookTo;      // column the castling rook went to
+      int      nMoves;      // mover's move count before the move
+      int      lastMove;    // mover's last move before the move
+      uint64_t hash;        // the hash before the move
+   };
 
    Piece* board[8][8];    // the board of chess pieces
    int numMoves;
+   uint64_t hash;         // Zobrist hash of the position, see getHash()
+
+   vector<Undo>   history;      // moves that can be taken back
+   vector<Piece*> spare[2][8];  // removed pieces by color and type, for reuse
 
    ogstream* pgout;
 };
@@ -81,6 +156,7 @@ public:
    BoardDummy()
    {
       numMoves = 0;
+      hash = 0;
       for (int row = 0; row < 8; ++row)
       {
          for (int col = 0; col < 8; ++col)
@@ -12,14 +12,112 @@
 #include "position.h"     // for POSITION
 #include "piece.h"        // for PIECE and company
 #include "board.h"        // for BOARD
+#include "perft.h"        // for PERFT
+#include "perftSuite.h"   // for PERFT SUITE
+#include "microBench.h"   // for MICRO BENCH
+#include "benchReport.h"  // for BENCH REPORT
+#include "diffTest.h"     // for DIFF TEST
+#include "bench.h"        // for BENCH
+#include "trace.h"        // for TRACE
+#include "memoryReport.h" // for MEMORY REPORT
+#include "search.h"       // for SEARCH
+#include "lazySmp.h"      // for LAZY SMP
 #include "test.h"
 #include <set>            // for STD::SET
 #include <cassert>        // for ASSERT
 #include <fstream>        // for IFSTREAM
 #include <string>         // for STRING
+#include <cstdlib>        // for ATOI
 #include <iostream>
+#include <memory>         // for UNIQUE_PTR
+#include <thread>         // for THREAD
+#include <atomic>         // for ATOMIC
+#include <vector>         // for VECTOR
 using namespace std;
 
+/*************************************
+ * GAME
+ * What the callback needs: the board, and the engine
+ * that plays whichever side was given to it. The engine
+ * thinks on its own thread, on its own copy of the board,
+ * so the window keeps drawing while it does
+ **************************************/
+struct Game
+{
+   Board* pBoard;
+   TranspositionTable* pTable;
+   int threads;
+   bool engineWhite;
+   bool engineBlack;
+   int depth;
+   int moveTime;                   // ms a move may take, or 0 to search to the depth
+   unique_ptr<Board> pThinking;    // the copy the engine searches
+   unique_ptr<LazySmp> pSearch;    // the search of that copy
+   thread thinker;                 // runs the search
+   atomic<bool> thought;           // the search has finished
+};
+
+/*************************************
+ * THINK
+ * Start the engine on a copy of the board. The
+ * board itself is only read by the window meanwhile
+ **************************************/
+void think(Game& game)
+{
+   game.pThinking.reset(new Board(*game.pBoard));
+   game.pSearch.reset(new LazySmp(*game.pThinking, game.pTable, game.threads));
+   game.thought.store(false, memory_order_relaxed);
+
+   TimeManager time;
+   if (game.moveTime > 0)
+      time.setMoveTime(game.moveTime);
+   int depth = game.depth;
+   game.thinker = thread([&game, depth, time]()
+   {
+      Trace::setThreadName("engine");
+      game.pSearch->search(depth, time);
+      game.thought.store(true, memory_order_release);
+   });
+}
+
+/*************************************
+ * STOP THINKING
+ * Wait for the engine, stopping it first if it is still
+ * searching, and let go of its copy of the board
+ **************************************/
+void stopThinking(Game& game)
+{
+   if (game.thinker.joinable())
+   {
+      // a stop before the search has started is forgotten when it
+      // starts, so keep asking until it has finished
+      while (!game.thought.load(memory_order_acquire))
+      {
+         game.pSearch->stop();
+         this_thread::yield();
+      }
+      game.thinker.join();
+   }
+   game.pSearch.reset();
+   if (game.pThinking)
+      game.pThinking->free();
+   game.pThinking.reset();
+}
+
+/*************************************
+ * GET LEGAL
+ * The legal moves of the piece on pos: the only ones
+ * drawn, and the only ones a click may play
+ **************************************/
+void getLegal(Board& board, const Position& pos, set<Move>& possible)
+{
+   vector<Move> moves;
+   board.generateMoves(moves);
+   for (const Move& move : moves)
+      if (move.getSrc() == pos)
+         possible.insert(move);
+}
+
 /*************************************
  * CALLBACK
  * All the interesting work happens here, when
@@ -30,16 +128,40 @@ using namespace std;
  **************************************/
 void callBack(Interface *pUI, void * p)
 {
+   TRACE_SCOPE("callBack");
+
    // the first step is to cast the void pointer into a game object. This
    // is the first step of every single callback function in OpenGL.
-   Board * pBoard = (Board *)p;
+   Game * pGame = (Game *)p;
+   Board * pBoard = pGame->pBoard;
+   set<Move> possible;
+
+   // the engine's turn: start it thinking, and once it is done play its
+   // move. The clicks wait until it is the player's turn again
+   if (pBoard->whiteTurn() ? pGame->engineWhite : pGame->engineBlack)
+   {
+      if (!pGame->thinker.joinable())
+      {
+         if (pBoard->countMoves() > 0)
+            think(*pGame);
+      }
+      else if (pGame->thought.load(memory_order_acquire))
+      {
+         pGame->thinker.join();
+         if (pGame->pSearch->hasBestMove())
+            pBoard->move(pGame->pSearch->getBestMove());
+         stopThinking(*pGame);
+      }
+      pUI->clearSelectPosition();
+      pBoard->display(pUI->getHoverPosition(), pUI->getSelectPosition(), possible);
+      return;
+   }
 
    Move move;
-   set<Move> possible;
    
    // Get the possible moves from the previous (source) location.
    if (pUI->getPreviousPosition().isValid())
-      (*pBoard)[pUI->getPreviousPosition()].getMoves(possible, *pBoard);
+      getLegal(*pBoard, pUI->getPreviousPosition(), possible);
    
    // Create the move that matches the source/dest to one of the possible moves.
    if (pUI->getSelectPosition().isValid() && pUI->getPreviousPosition().isValid())
@@ -55,7 +177,7 @@ void callBack(Interface *pUI, void * p)
    else if (pUI->getSelectPosition().isValid())
    {
       possible.clear();
-      (*pBoard)[pUI->getSelectPosition()].getMoves(possible, *pBoard);
+      getLegal(*pBoard, pUI->getSelectPosition(), possible);
    }
    
    // if we clicked on a blank spot, then it is not selected
@@ -102,24 +224,77 @@ int WINAPI WinMain(
 int main(int argc, char** argv)
 #endif // !_WIN32
 {
-   // Run unit tests
-   testRunner();
+   // --trace file records a timeline of any mode, written at exit
+   argc = Trace::commandLine(argc, argv);
+
+   // Command line modes that do not need the window
+   if (argc > 1 && string(argv[1]) == "perft")
+      return perftCommand(argc, argv);
+   if (argc > 1 && string(argv[1]) == "perftsuite")
+      return perftSuiteCommand(argc, argv);
+   if (argc > 1 && string(argv[1]) == "microbench")
+      return microBenchCommand(argc, argv);
+   if (argc > 1 && string(argv[1]) == "benchcompare")
+      return benchCompareCommand(argc, argv);
+   if (argc > 1 && string(argv[1]) == "difftest")
+      return diffTestCommand(argc, argv);
+   if (argc > 1 && string(argv[1]) == "bench")
+      return benchCommand(argc, argv);
+   if (argc > 1 && string(argv[1]) == "memory")
+      return memoryCommand(argc, argv);
+   if (argc > 1 && string(argv[1]) == "search")
+      return searchCommand(argc, argv);
+   if (argc > 1 && string(argv[1]) == "test")
+      return testCommand(argc, argv);
    
    // Initialize graphics and game
    Interface ui("Chess");
    ogstream* pgout = new ogstream;
    Board board(pgout);
+   TranspositionTable table(64);
+   cout << "Hash: " << table.describe() << endl;
+   Game game;
+   game.pBoard = &board;
+   game.pTable = &table;
+   game.threads = 1;
+   game.engineWhite = false;
+   game.engineBlack = false;
+   game.depth = Search::MAX_PLY;
+   game.moveTime = 1000;
 
-   // If a moves file was provided , execute those moves
-   if (argc > 1) {
-       cout << "Loading moves from: " << argv[1] << endl;
-       readFile(argv[1], board);
+   // --engine white|black gives a side to the engine, --movetime sets
+   // how long it thinks, --depth how far it looks instead, --threads how
+   // many threads it thinks on, and anything else is a file of moves
+   for (int i = 1; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--engine" && i + 1 < argc)
+      {
+         string side(argv[++i]);
+         game.engineWhite = game.engineWhite || side == "white";
+         game.engineBlack = game.engineBlack || side == "black";
+      }
+      else if (arg == "--movetime" && i + 1 < argc)
+         game.moveTime = atoi(argv[++i]);
+      else if (arg == "--depth" && i + 1 < argc)
+      {
+         game.depth = atoi(argv[++i]);
+         game.moveTime = 0;
+      }
+      else if (arg == "--threads" && i + 1 < argc)
+         game.threads = atoi(argv[++i]);
+      else
+      {
+         cout << "Loading moves from: " << argv[i] << endl;
+         readFile(argv[i], board);
+      }
    }
 
    // Start the game loop
-   ui.run(callBack, (void *)(&board));
+   ui.run(callBack, (void *)(&game));
    
    // Cleanup
+   stopThinking(game);
    delete pgout;
    return 0;
 }
@@ -0,0 +1,244 @@
+/***********************************************************************
+ * Source File:
+ *    DIFF TEST
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Differential testing of the move generators. Random games are
+ *    played, and at every ply the moves from the reference generator
+ *    (the pieces' getMoves()) are compared with those from the
+ *    optimized one. The first position where they differ is reported
+ ************************************************************************/
+
+#include "diffTest.h"
+#include "board.h"
+#include "perftSuite.h"
+#include "threadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <cstdlib>
+using namespace std;
+
+/***************************************************
+ * DIFFERENCE
+ * The moves in the first list but not the second, and the
+ * other way around. A move listed twice counts twice
+ ***************************************************/
+static void difference(const vector<Move>& reference, const vector<Move>& optimized,
+                       vector<string>& onlyReference, vector<string>& onlyOptimized)
+{
+   vector<string> textReference;
+   vector<string> textOptimized;
+   for (const Move& move : reference)
+      textReference.push_back(DiffTest::describe(move));
+   for (const Move& move : optimized)
+      textOptimized.push_back(DiffTest::describe(move));
+   sort(textReference.begin(), textReference.end());
+   sort(textOptimized.begin(), textOptimized.end());
+
+   onlyReference.clear();
+   onlyOptimized.clear();
+   set_difference(textReference.begin(), textReference.end(),
+                  textOptimized.begin(), textOptimized.end(), back_inserter(onlyReference));
+   set_difference(textOptimized.begin(), textOptimized.end(),
+                  textReference.begin(), textReference.end(), back_inserter(onlyOptimized));
+}
+
+/***************************************************
+ * DIFF TEST : CONSTRUCTOR
+ ***************************************************/
+DiffTest::DiffTest() :
+   reference([](Board& board, vector<Move>& moves) { board.getMoves(moves); }),
+   optimized([](Board& board, vector<Move>& moves) { board.generateMoves(moves); }),
+   maxPlies(200)
+{
+}
+
+DiffTest::DiffTest(Generator reference, Generator optimized) :
+   reference(reference), optimized(optimized), maxPlies(200)
+{
+}
+
+/***************************************************
+ * DIFF TEST : DESCRIBE
+ * The coordinates, then the side, capture, and special
+ * move, so two moves match only if they are made the same way
+ ***************************************************/
+string DiffTest::describe(const Move& move)
+{
+   const char letters[] = "??kqrbnp";
+   string text = move.getUCI();
+   text += move.getWhiteMove() ? " w" : " b";
+   if (move.getCapture() != SPACE && move.getCapture() != INVALID)
+   {
+      text += " x";
+      text += letters[move.getCapture()];
+   }
+   if (move.getEnPassant())
+      text += " e.p.";
+   if (move.getCastleK())
+      text += " O-O";
+   if (move.getCastleQ())
+      text += " O-O-O";
+   return text;
+}
+
+/***************************************************
+ * DIFF TEST : COMPARE
+ ***************************************************/
+bool DiffTest::compare(Board& board, vector<string>& onlyReference,
+                       vector<string>& onlyOptimized) const
+{
+   vector<Move> movesReference;
+   vector<Move> movesOptimized;
+   reference(board, movesReference);
+   optimized(board, movesOptimized);
+   difference(movesReference, movesOptimized, onlyReference, onlyOptimized);
+   return onlyReference.empty() && onlyOptimized.empty();
+}
+
+/***************************************************
+ * DIFF TEST : RUN
+ * Each thread plays its own games on its own board with
+ * its own random numbers, until one finds a difference
+ ***************************************************/
+DiffTest::Result DiffTest::run(double seconds, int threads, uint64_t seed, uint64_t maxGames)
+{
+   Result total = { 0, 0, false, string(), {}, {} };
+   atomic<bool> stop(false);
+   atomic<uint64_t> started(0);
+   mutex lock;
+   auto deadline = chrono::steady_clock::now() + chrono::duration<double>(seconds);
+
+   ThreadPool pool(threads);
+   for (int t = 0; t < threads; t++)
+      pool.submit([&, t](int)
+      {
+         Board board(nullptr, true /*noreset*/);
+         mt19937_64 random(seed + t * 0x9E3779B97F4A7C15ull);
+         Result result = { 0, 0, false, string(), {}, {} };
+         while (!stop && chrono::steady_clock::now() < deadline &&
+                (maxGames == 0 || started++ < maxGames))
+         {
+            play(board, random, result, stop);
+            if (result.diverged)
+            {
+               lock_guard<mutex> guard(lock);
+               if (!total.diverged)
+               {
+                  total.diverged = true;
+                  total.fen = result.fen;
+                  total.onlyReference = result.onlyReference;
+                  total.onlyOptimized = result.onlyOptimized;
+               }
+               stop = true;
+            }
+         }
+
+         lock_guard<mutex> guard(lock);
+         total.games += result.games;
+         total.positions += result.positions;
+         board.free();
+      });
+   pool.wait();
+   return total;
+}
+
+/***************************************************
+ * DIFF TEST : PLAY
+ * One random game from the start or from a perft suite
+ * position, which reach castling, en passant, and promotion
+ * far more often than games from the start
+ ***************************************************/
+void DiffTest::play(Board& board, mt19937_64& random, Result& result, atomic<bool>& stop) const
+{
+   const vector<PerftSuite::Case>& cases = PerftSuite::getCases();
+   board.readFEN(cases[random() % cases.size()].fen);
+
+   vector<Move> movesReference;
+   vector<Move> movesOptimized;
+   for (int ply = 0; ply < maxPlies && !stop; ply++)
+   {
+      result.positions++;
+      reference(board, movesReference);
+      optimized(board, movesOptimized);
+      difference(movesReference, movesOptimized, result.onlyReference, result.onlyOptimized);
+      if (!result.onlyReference.empty() || !result.onlyOptimized.empty())
+      {
+         result.diverged = true;
+         result.fen = board.getFEN();
+         return;
+      }
+
+      // checkmate or stalemate
+      if (movesReference.empty())
+         break;
+      board.move(movesReference[random() % movesReference.size()]);
+   }
+   result.games++;
+}
+
+/***************************************************
+ * DIFF TEST COMMAND
+ * Run from the command line. The exit code is 1 if the
+ * generators disagreed anywhere
+ ***************************************************/
+int diffTestCommand(int argc, char** argv)
+{
+   double seconds = 10.0;
+   int threads = (int)thread::hardware_concurrency();
+   uint64_t seed = 1;
+   uint64_t games = 0;
+   int plies = 200;
+   for (int i = 2; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--time" && i + 1 < argc)
+         seconds = atof(argv[++i]);
+      else if (arg == "--threads" && i + 1 < argc)
+         threads = atoi(argv[++i]);
+      else if (arg == "--seed" && i + 1 < argc)
+         seed = strtoull(argv[++i], nullptr, 10);
+      else if (arg == "--games" && i + 1 < argc)
+         games = strtoull(argv[++i], nullptr, 10);
+      else if (arg == "--plies" && i + 1 < argc)
+         plies = atoi(argv[++i]);
+      else
+      {
+         cerr << "Usage: " << argv[0] << " difftest [--time seconds] [--threads N] "
+              << "[--seed N] [--games N] [--plies N]\n";
+         return 1;
+      }
+   }
+   if (threads < 1)
+      threads = 1;
+
+   DiffTest diffTest;
+   diffTest.setMaxPlies(plies);
+   auto begin = chrono::steady_clock::now();
+   DiffTest::Result result = diffTest.run(seconds, threads, seed, games);
+   double elapsed = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+   cout << "Games:        " << result.games << "\n"
+        << "Positions:    " << result.positions << "\n"
+        << "Threads:      " << threads << "\n"
+        << "Seed:         " << seed << "\n"
+        << "Time:         " << elapsed << " s\n"
+        << "Positions/s:  " << (uint64_t)(elapsed > 0.0 ? result.positions / elapsed : 0.0) << "\n";
+   if (!result.diverged)
+   {
+      cout << "Result:       the generators agree\n";
+      return 0;
+   }
+
+   cout << "Result:       DIVERGED\n"
+        << "Position:     " << result.fen << "\n";
+   for (const string& move : result.onlyReference)
+      cout << "  only reference: " << move << "\n";
+   for (const string& move : result.onlyOptimized)
+      cout << "  only optimized: " << move << "\n";
+   return 1;
+}
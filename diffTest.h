@@ -0,0 +1,77 @@
+/***********************************************************************
+ * Header File:
+ *    DIFF TEST
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Differential testing of the move generators. Random games are
+ *    played, and at every ply the moves from the reference generator
+ *    (the pieces' getMoves()) are compared with those from the
+ *    optimized one. The first position where they differ is reported
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+#include <random>
+#include <atomic>
+#include "move.h"
+
+using std::string;
+using std::vector;
+
+class Board;
+class TestDiffTest;
+
+/***************************************************
+ * DIFF TEST
+ * Two move generators that must always agree
+ ***************************************************/
+class DiffTest
+{
+   friend TestDiffTest;
+public:
+   // fills the list with every legal move of the side to move
+   typedef std::function<void(Board& board, vector<Move>& moves)> Generator;
+
+   // what a run found
+   struct Result
+   {
+      uint64_t games;                  // games played to the end or the ply limit
+      uint64_t positions;              // positions where the generators were compared
+      bool     diverged;
+      string   fen;                    // the first position where they differ
+      vector<string> onlyReference;    // moves only the reference generated there
+      vector<string> onlyOptimized;    // moves only the optimized generator did
+   };
+
+   // Board::getMoves() against Board::generateMoves()
+   DiffTest();
+   DiffTest(Generator reference, Generator optimized);
+
+   // play games until the time is up, a difference is found,
+   // or (if not zero) maxGames have been played
+   Result run(double seconds, int threads, uint64_t seed, uint64_t maxGames = 0);
+
+   // compare the generators on one position: true when they agree
+   bool compare(Board& board, vector<string>& onlyReference, vector<string>& onlyOptimized) const;
+
+   void setMaxPlies(int maxPlies) { this->maxPlies = maxPlies; }
+
+   // a move as text with everything the generators decide about it
+   static string describe(const Move& move);
+
+private:
+   void play(Board& board, std::mt19937_64& random, Result& result,
+             std::atomic<bool>& stop) const;
+
+   Generator reference;
+   Generator optimized;
+   int maxPlies;           // a game stops here if it has not ended
+};
+
+// the "difftest [options]" command line mode
+int diffTestCommand(int argc, char** argv);
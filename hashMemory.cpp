@@ -0,0 +1,182 @@
+/***********************************************************************
+ * Source File:
+ *    HASH MEMORY
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The memory under a hash table: huge pages where the system will
+ *    give them, so a big table does not thrash the TLB, and cleared by
+ *    several threads so its pages start out spread over the sockets
+ ************************************************************************/
+
+#include "hashMemory.h"
+#include "threadPool.h"
+#include <cstring>
+#include <cstdint>
+#include <new>
+#include <sstream>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+static const size_t CACHE_LINE = 64;
+
+/***************************************************
+ * HASH MEMORY : CONSTRUCTOR
+ * A table too small for a huge page comes from the heap
+ ***************************************************/
+HashMemory::HashMemory(size_t bytes) :
+   p(nullptr), pMapped(nullptr), bytes(bytes), bytesMapped(0), mode(HEAP)
+{
+#ifndef _WIN32
+   if (bytes >= HUGE_PAGE_SIZE)
+   {
+      size_t rounded = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+#ifdef MAP_HUGETLB
+      // pages the administrator set aside, if there are enough
+      pMapped = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (pMapped != MAP_FAILED)
+      {
+         p = pMapped;
+         bytesMapped = rounded;
+         mode = HUGE_PAGES;
+         return;
+      }
+#endif // MAP_HUGETLB
+
+      // ordinary pages, one huge page extra so the start can be aligned to
+      // one, and the kernel asked to back them with huge pages
+      pMapped = mmap(nullptr, rounded + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (pMapped != MAP_FAILED)
+      {
+         bytesMapped = rounded + HUGE_PAGE_SIZE;
+         uintptr_t start = ((uintptr_t)pMapped + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1);
+         p = (void*)start;
+         mode = PAGES;
+#ifdef MADV_HUGEPAGE
+         if (madvise(p, rounded, MADV_HUGEPAGE) == 0)
+            mode = TRANSPARENT_HUGE_PAGES;
+#endif // MADV_HUGEPAGE
+         return;
+      }
+      pMapped = nullptr;
+   }
+#else // _WIN32
+   // large pages need a privilege most accounts lack, so plain pages
+   pMapped = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+   if (pMapped)
+   {
+      p = pMapped;
+      bytesMapped = bytes;
+      mode = PAGES;
+      return;
+   }
+#endif // _WIN32
+
+   p = ::operator new(bytes, align_val_t(CACHE_LINE));
+}
+
+/***************************************************
+ * HASH MEMORY : DESTRUCTOR
+ ***************************************************/
+HashMemory::~HashMemory()
+{
+   if (mode == HEAP)
+      ::operator delete(p, align_val_t(CACHE_LINE));
+#ifdef _WIN32
+   else
+      VirtualFree(pMapped, 0, MEM_RELEASE);
+#else
+   else
+      munmap(pMapped, bytesMapped);
+#endif
+}
+
+/***************************************************
+ * HASH MEMORY : CLEAR
+ * Whole huge pages to each thread, so no page is split
+ * between two of them
+ ***************************************************/
+void HashMemory::clear(int threads)
+{
+   if (threads <= 0)
+      threads = (int)thread::hardware_concurrency();
+   size_t chunk = HUGE_PAGE_SIZE;
+   size_t numChunks = (bytes + chunk - 1) / chunk;
+   if (threads <= 1 || numChunks <= 1)
+   {
+      memset(p, 0, bytes);
+      return;
+   }
+
+   if ((size_t)threads > numChunks)
+      threads = (int)numChunks;
+   ThreadPool pool(threads);
+   size_t perThread = (numChunks + threads - 1) / threads * chunk;
+   for (size_t begin = 0; begin < bytes; begin += perThread)
+   {
+      size_t size = bytes - begin < perThread ? bytes - begin : perThread;
+      char* pBegin = (char*)p + begin;
+      pool.submit([pBegin, size](int) { memset(pBegin, 0, size); });
+   }
+   pool.wait();
+}
+
+/***************************************************
+ * HASH MEMORY : GET MODE NAME
+ ***************************************************/
+const char* HashMemory::getModeName(Mode mode)
+{
+   switch (mode)
+   {
+   case HUGE_PAGES:             return "huge pages";
+   case TRANSPARENT_HUGE_PAGES: return "transparent huge pages";
+   case PAGES:                  return "pages";
+   case HEAP:                   return "heap";
+   }
+   return "unknown";
+}
+
+/***************************************************
+ * HASH MEMORY : DESCRIBE
+ * For example "64 MB, transparent huge pages, 2 NUMA nodes"
+ ***************************************************/
+string HashMemory::describe() const
+{
+   ostringstream out;
+   int nodes = getNumNodes();
+   if (bytes >= (1 << 20))
+      out << (bytes >> 20) << " MB";
+   else
+      out << (bytes >> 10) << " KB";
+   out << ", " << getModeName(mode) << ", " << nodes << " NUMA node" << (nodes == 1 ? "" : "s");
+   return out.str();
+}
+
+/***************************************************
+ * HASH MEMORY : GET NUM NODES
+ * From the nodes Linux lists under /sys
+ ***************************************************/
+int HashMemory::getNumNodes()
+{
+#ifndef _WIN32
+   int nodes = 0;
+   while (true)
+   {
+      string path = "/sys/devices/system/node/node" + to_string(nodes);
+      if (access(path.c_str(), F_OK) != 0)
+         break;
+      nodes++;
+   }
+   return nodes > 0 ? nodes : 1;
+#else
+   return 1;
+#endif
+}
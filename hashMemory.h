@@ -0,0 +1,65 @@
+/***********************************************************************
+ * Header File:
+ *    HASH MEMORY
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The memory under a hash table: huge pages where the system will
+ *    give them, so a big table does not thrash the TLB, and cleared by
+ *    several threads so its pages start out spread over the sockets
+ ************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+using std::string;
+
+class TestHashMemory;
+
+/***************************************************
+ * HASH MEMORY
+ * Memory aligned to a cache line, from the best source that
+ * works: explicit huge pages, then ordinary pages the kernel
+ * is asked to back with transparent huge pages, then the heap.
+ * Each step falls back to the next. Nothing touches the pages
+ * until clear(), which the owner calls before using them
+ ***************************************************/
+class HashMemory
+{
+   friend TestHashMemory;
+public:
+   // where the memory came from
+   enum Mode { HEAP, PAGES, TRANSPARENT_HUGE_PAGES, HUGE_PAGES };
+
+   static const size_t HUGE_PAGE_SIZE = 2 << 20;
+
+   HashMemory(size_t bytes);
+   ~HashMemory();
+   HashMemory(const HashMemory&) = delete;
+   HashMemory& operator = (const HashMemory&) = delete;
+
+   void*  get()      const { return p;     }
+   size_t getBytes() const { return bytes; }
+   Mode   getMode()  const { return mode;  }
+
+   // zero it, with each thread writing its own share, one thread per
+   // core by default. The first write to a page decides which socket's
+   // memory backs it
+   void clear(int threads = 0);
+
+   // how the memory was allocated, for the start of a run
+   string describe() const;
+   static const char* getModeName(Mode mode);
+
+   // the NUMA nodes in the machine, 1 if it cannot tell
+   static int getNumNodes();
+
+private:
+   void*  p;          // the aligned start handed out
+   void*  pMapped;    // what was mapped, to unmap
+   size_t bytes;
+   size_t bytesMapped;
+   Mode   mode;
+};
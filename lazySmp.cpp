@@ -0,0 +1,111 @@
+/***********************************************************************
+ * Source File:
+ *    LAZY SMP
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Search on several threads at once. Every thread searches the
+ *    whole tree on its own board, and they help each other only
+ *    through what they leave in the shared transposition table
+ ************************************************************************/
+
+#include "lazySmp.h"
+#include "board.h"
+#include "trace.h"
+#include <string>
+#include <thread>
+using namespace std;
+
+/***************************************************
+ * LAZY SMP : CONSTRUCTOR
+ ***************************************************/
+LazySmp::LazySmp(Board& board, TranspositionTable* pTable, int threads) :
+   board(board),
+   pTable(pTable),
+   threads(threads < 1 ? 1 : (threads > MAX_THREADS ? MAX_THREADS : threads)),
+   done(false),
+   iBest(0)
+{
+   searches.push_back(unique_ptr<Search>(new Search(board, pTable)));
+   pMain = searches[0].get();
+}
+
+/***************************************************
+ * LAZY SMP : DESTRUCTOR
+ ***************************************************/
+LazySmp::~LazySmp()
+{
+   for (unique_ptr<Board>& pBoard : boards)
+      pBoard->free();
+}
+
+/***************************************************
+ * LAZY SMP : SEARCH
+ * Start the helpers on copies of the board, search on
+ * this thread, then stop the helpers and pick the answer
+ ***************************************************/
+int LazySmp::search(int depth, const TimeManager& time)
+{
+   TRACE_SCOPE("LazySmp::search");
+
+   // the last search's helpers and their boards
+   searches.resize(1);
+   for (unique_ptr<Board>& pBoard : boards)
+      pBoard->free();
+   boards.clear();
+
+   // every thread's entries belong to the same search
+   if (pTable)
+      pTable->newSearch();
+   done.store(false, memory_order_relaxed);
+   searches[0]->setThread(0, &done);
+   for (int i = 1; i < threads; i++)
+   {
+      boards.push_back(unique_ptr<Board>(new Board(board)));
+      searches.push_back(unique_ptr<Search>(new Search(*boards.back(), pTable)));
+      searches.back()->setThread(i, &done);
+   }
+
+   vector<thread> helpers;
+   for (int i = 1; i < threads; i++)
+      helpers.push_back(thread([this, i, depth]()
+      {
+         string name = "helper " + to_string(i);
+         Trace::setThreadName(name.c_str());
+         searches[i]->search(depth);
+      }));
+
+   searches[0]->search(depth, time);
+
+   done.store(true, memory_order_relaxed);
+   for (thread& helper : helpers)
+      helper.join();
+
+   iBest = 0;
+   for (int i = 1; i < threads; i++)
+      if (searches[i]->getDepth() > searches[iBest]->getDepth())
+         iBest = i;
+   return getScore();
+}
+
+/***************************************************
+ * LAZY SMP : STOP
+ * The vector of searches grows while a search starts, so
+ * the main search is reached through its own pointer
+ ***************************************************/
+void LazySmp::stop()
+{
+   done.store(true, memory_order_relaxed);
+   pMain->stop();
+}
+
+/***************************************************
+ * LAZY SMP : GET NODES
+ ***************************************************/
+uint64_t LazySmp::getNodes() const
+{
+   uint64_t nodes = 0;
+   for (const unique_ptr<Search>& pSearch : searches)
+      nodes += pSearch->getNodes();
+   return nodes;
+}
@@ -0,0 +1,77 @@
+/***********************************************************************
+ * Header File:
+ *    LAZY SMP
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Search on several threads at once. Every thread searches the
+ *    whole tree on its own board, and they help each other only
+ *    through what they leave in the shared transposition table
+ ************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <iostream>
+#include "search.h"
+
+using std::vector;
+using std::unique_ptr;
+using std::ostream;
+
+class Board;
+class TestLazySmp;
+
+/***************************************************
+ * LAZY SMP
+ * The main search runs on the calling thread with the caller's
+ * board and clock. For each search every helper gets a fresh copy
+ * of the board, its own Search, and no limit but the depth; they
+ * are stopped when the main search finishes. The answer comes
+ * from whichever thread completed the deepest iteration, the
+ * main one on a tie
+ ***************************************************/
+class LazySmp
+{
+   friend TestLazySmp;
+public:
+   static const int MAX_THREADS = 64;
+
+   LazySmp(Board& board, TranspositionTable* pTable, int threads = 1);
+   ~LazySmp();
+
+   // search on every thread and return the score for the side to move
+   int search(int depth, const TimeManager& time = TimeManager());
+
+   // stop every thread as soon as it can. Safe from any thread
+   void stop();
+
+   // the main search prints its iterations here
+   void setOutput(ostream* pOut) { searches[0]->setOutput(pOut); }
+
+   // the results of the thread that went deepest
+   const Move&  getBestMove() const { return best().getBestMove(); }
+   vector<Move> getPV()       const { return best().getPV();       }
+   int          getScore()    const { return best().getScore();    }
+   int          getDepth()    const { return best().getDepth();    }
+   bool         hasBestMove() const { return best().hasBestMove(); }
+
+   // positions visited by every thread together
+   uint64_t getNodes() const;
+   int      getThreads() const { return threads; }
+
+private:
+   const Search& best() const { return *searches[iBest]; }
+
+   Board& board;
+   TranspositionTable* pTable;
+   int threads;
+   vector<unique_ptr<Board>> boards;     // the helpers' copies
+   vector<unique_ptr<Search>> searches;  // the main search, then the helpers
+   Search* pMain;                        // searches[0], for stop() on another thread
+   std::atomic<bool> done;               // the helpers should stop
+   int iBest;
+};
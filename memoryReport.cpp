@@ -0,0 +1,161 @@
+/***********************************************************************
+ * Source File:
+ *    MEMORY REPORT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    How many bytes each part of the program holds: the board and its
+ *    heap pieces, the move lists, the hash tables, and the history.
+ *    Each of them adds its own lines with its memoryReport() method
+ ************************************************************************/
+
+#include "memoryReport.h"
+#include "board.h"
+#include "perft.h"
+#include "perftTable.h"
+#include "search.h"
+#include "transpositionTable.h"
+#include <iomanip>
+#include <memory>
+#include <cstdlib>
+using namespace std;
+
+/***************************************************
+ * MEMORY REPORT : ADD
+ ***************************************************/
+void MemoryReport::add(const string& subsystem, const string& name, size_t count, size_t bytes)
+{
+   items.push_back({ subsystem, name, count, bytes });
+}
+
+/***************************************************
+ * MEMORY REPORT : GET BYTES
+ ***************************************************/
+size_t MemoryReport::getBytes() const
+{
+   size_t bytes = 0;
+   for (const Item& item : items)
+      bytes += item.bytes;
+   return bytes;
+}
+
+size_t MemoryReport::getBytes(const string& subsystem) const
+{
+   size_t bytes = 0;
+   for (const Item& item : items)
+      if (item.subsystem == subsystem)
+         bytes += item.bytes;
+   return bytes;
+}
+
+/***************************************************
+ * MEMORY REPORT : GET HEAP BYTES
+ * A short string keeps its characters inside itself. Only
+ * when they live elsewhere is the capacity on the heap
+ ***************************************************/
+size_t MemoryReport::getHeapBytes(const string& text)
+{
+   const char* begin = reinterpret_cast<const char*>(&text);
+   const char* data = text.data();
+   if (data >= begin && data < begin + sizeof(string))
+      return 0;
+   return text.capacity() + 1;
+}
+
+/***************************************************
+ * MEMORY REPORT : GET HEAP BYTES
+ * The whole capacity is held whether or not it is used
+ ***************************************************/
+size_t MemoryReport::getHeapBytes(const vector<Move>& moves)
+{
+   size_t bytes = moves.capacity() * sizeof(Move);
+   for (const Move& move : moves)
+      bytes += move.getHeapBytes();
+   return bytes;
+}
+
+/***************************************************
+ * MEMORY REPORT : WRITE
+ * The lines in the order they were added, each
+ * subsystem followed by its subtotal
+ ***************************************************/
+void MemoryReport::write(ostream& out) const
+{
+   out << left << setw(12) << "Subsystem" << setw(28) << "Item" << right
+       << setw(10) << "Count" << setw(14) << "Bytes" << setw(10) << "Each" << "\n";
+
+   for (size_t i = 0; i < items.size(); i++)
+   {
+      const Item& item = items[i];
+      out << left << setw(12) << item.subsystem << setw(28) << item.name << right
+          << setw(10) << item.count << setw(14) << item.bytes << setw(10);
+      if (item.count)
+         out << item.bytes / item.count;
+      else
+         out << "-";
+      out << "\n";
+
+      if (i + 1 == items.size() || items[i + 1].subsystem != item.subsystem)
+         out << left << setw(12) << "" << setw(28) << ("all of " + item.subsystem) << right
+             << setw(10) << "" << setw(14) << getBytes(item.subsystem) << "\n";
+   }
+   out << left << setw(40) << "Total" << right << setw(10) << ""
+       << setw(14) << getBytes() << "\n";
+}
+
+/***************************************************
+ * MEMORY COMMAND
+ * Set up a board, run a perft and a search over it so that the
+ * move lists, history, and hash tables hold what they do in use,
+ * and report
+ ***************************************************/
+int memoryCommand(int argc, char** argv)
+{
+   int depth = 4;
+   size_t megabytes = 0;
+   size_t megabytesSearch = 16;
+
+   // the FEN has spaces in it, so it may arrive as several arguments
+   string fen;
+   for (int i = 2; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--depth" && i + 1 < argc)
+         depth = atoi(argv[++i]);
+      else if (arg == "--hash" && i + 1 < argc)
+         megabytes = (size_t)atoi(argv[++i]);
+      else if (arg == "--tt" && i + 1 < argc)
+         megabytesSearch = (size_t)atoi(argv[++i]);
+      else
+         fen += (fen.empty() ? "" : " ") + arg;
+   }
+   if (fen.empty())
+      fen = FEN_INITIAL;
+
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(fen);
+   unique_ptr<PerftTable> pTable(megabytes > 0 ? new PerftTable(megabytes) : nullptr);
+   Perft perft(board, true /*bulk*/, false /*fast*/, pTable.get());
+   perft.count(depth);
+   unique_ptr<TranspositionTable> pTableSearch(megabytesSearch > 0 ?
+                                               new TranspositionTable(megabytesSearch) : nullptr);
+   Search search(board, pTableSearch.get());
+   search.search(depth);
+
+   MemoryReport report;
+   board.memoryReport(report);
+   perft.memoryReport(report);
+   if (pTable)
+      pTable->memoryReport(report);
+   if (pTableSearch)
+      pTableSearch->memoryReport(report);
+
+   cout << "Position:     " << fen << "\n"
+        << "Depth:        " << depth << "\n"
+        << "Hash:         " << (pTable ? pTable->describe() : string("none")) << "\n"
+        << "Table:        " << (pTableSearch ? pTableSearch->describe() : string("none")) << "\n\n";
+   report.write(cout);
+
+   board.free();
+   return 0;
+}
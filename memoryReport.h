@@ -0,0 +1,63 @@
+/***********************************************************************
+ * Header File:
+ *    MEMORY REPORT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    How many bytes each part of the program holds: the board and its
+ *    heap pieces, the move lists, the hash tables, and the history.
+ *    Each of them adds its own lines with its memoryReport() method
+ ************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <iostream>
+#include "move.h"
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+/***************************************************
+ * MEMORY REPORT
+ * Lines of bytes, grouped by subsystem. The bytes are what was
+ * asked of the heap or held in place; the allocator's own
+ * overhead per block is not included
+ ***************************************************/
+class MemoryReport
+{
+public:
+   struct Item
+   {
+      string subsystem;    // "Board", "Moves", "Hash", ...
+      string name;
+      size_t count;        // how many objects
+      size_t bytes;        // their bytes all together
+   };
+
+   void add(const string& subsystem, const string& name, size_t count, size_t bytes);
+
+
+   const vector<Item>& getItems() const { return items; }
+   size_t getBytes() const;
+   size_t getBytes(const string& subsystem) const;
+
+   // a table of the lines with a subtotal for each subsystem
+   void write(ostream& out) const;
+
+   // the heap bytes behind a string, zero when it fits in the string itself
+   static size_t getHeapBytes(const string& text);
+
+   // the heap bytes of a list of moves: its whole capacity, and any
+   // text a move keeps on the heap
+   static size_t getHeapBytes(const vector<Move>& moves);
+
+private:
+   vector<Item> items;
+};
+
+// the "memory [--depth N] [--hash MB] [FEN]" command line mode
+int memoryCommand(int argc, char** argv);
@@ -0,0 +1,467 @@
+/***********************************************************************
+ * Source File:
+ *    MICRO BENCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Time small operations, such as a single Board::move() or one
+ *    piece's getMoves(), in nanoseconds each. Every case is warmed up,
+ *    then timed over several repetitions so the spread can be reported.
+ *    The heap allocations of each operation are counted as well
+ ************************************************************************/
+
+#include "microBench.h"
+#include "allocScope.h"
+#include "benchReport.h"
+#include "perfCounters.h"
+#include "board.h"
+#include "move.h"
+#include "position.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <cstdlib>
+#include <fstream>
+using namespace std;
+
+// where consume() puts values so the work behind them has to be done
+static volatile size_t sink = 0;
+
+/***************************************************
+ * MICRO BENCH : CONSUME
+ ***************************************************/
+void MicroBench::consume(size_t value)
+{
+   sink = sink + value;
+}
+
+/***************************************************
+ * MICRO BENCH : ADD
+ ***************************************************/
+void MicroBench::add(const string& name, Body body)
+{
+   cases.push_back({ name, nullptr, body, nullptr, 1 << 30 });
+}
+
+void MicroBench::add(const string& name, Body setup, Body body, Body teardown, int maxIterations)
+{
+   cases.push_back({ name, setup, body, teardown, maxIterations });
+}
+
+/***************************************************
+ * MICRO BENCH : RUN
+ * Run every case whose name contains filter
+ ***************************************************/
+vector<MicroBench::Result> MicroBench::run(ostream& out, const string& filter)
+{
+   vector<Result> results;
+   out << left << setw(32) << "Case" << right << setw(11) << "Iterations"
+       << setw(11) << "ns/op" << setw(11) << "+/-" << setw(8) << "%"
+       << setw(11) << "min" << setw(11) << "median"
+       << setw(9) << "allocs" << setw(9) << "bytes" << "\n";
+   for (const Case& test : cases)
+   {
+      if (test.name.find(filter) == string::npos)
+         continue;
+      Result result = run(test);
+      double mean = result.getMean();
+      out << left << setw(32) << result.name << right << setw(11) << result.iterations
+          << fixed << setprecision(1)
+          << setw(11) << mean
+          << setw(11) << result.getStdDev()
+          << setw(8) << (mean > 0.0 ? 100.0 * result.getStdDev() / mean : 0.0)
+          << setw(11) << result.getMin()
+          << setw(11) << result.getMedian()
+          << setw(9);
+      if (AllocScope::enabled)
+         out << result.allocations << setw(9) << result.bytes << endl;
+      else
+         out << "n/a" << setw(9) << "n/a" << endl;
+      results.push_back(result);
+   }
+
+   // the hardware counters get a table of their own
+   if (pCounters)
+   {
+      out << "\n" << left << setw(32) << "Case" << right;
+      for (int i = 0; i < PerfCounters::NUM_EVENTS; i++)
+         out << setw(15) << PerfCounters::getName((PerfCounters::Event)i);
+      out << setw(8) << "IPC" << "\n";
+      for (const Result& result : results)
+      {
+         out << left << setw(32) << result.name << right << fixed << setprecision(1);
+         for (int i = 0; i < PerfCounters::NUM_EVENTS; i++)
+            if (pCounters->isAvailable((PerfCounters::Event)i))
+               out << setw(15) << result.counters[i];
+            else
+               out << setw(15) << "n/a";
+         double cycles = result.counters[PerfCounters::CYCLES];
+         if (cycles > 0.0)
+            out << setw(8) << setprecision(2) << result.counters[PerfCounters::INSTRUCTIONS] / cycles;
+         else
+            out << setw(8) << "n/a";
+         out << endl;
+      }
+   }
+   return results;
+}
+
+/***************************************************
+ * MICRO BENCH : RUN
+ * Warm up while finding how many iterations fill a repetition,
+ * then time each repetition at that many iterations
+ ***************************************************/
+MicroBench::Result MicroBench::run(const Case& test) const
+{
+   int iterations = 1;
+   for (;;)
+   {
+      double seconds = time(test, iterations).seconds;
+      if (seconds >= secondsPerRepetition || iterations >= test.maxIterations)
+         break;
+
+      // aim straight for the target once the time is measurable
+      double next = (seconds > 0.0) ? iterations * secondsPerRepetition / seconds : iterations * 10.0;
+      next = std::max(next, iterations * 2.0);
+      iterations = (int)std::min(next, (double)test.maxIterations);
+   }
+   Sample sample = time(test, iterations);
+
+   Result result;
+   result.name = test.name;
+   result.iterations = iterations;
+   result.allocations = (double)sample.allocations / iterations;
+   result.bytes = (double)sample.bytes / iterations;
+   for (double count : sample.counters)
+      result.counters.push_back(count / iterations);
+   for (int i = 0; i < repetitions; i++)
+      result.samples.push_back(time(test, iterations).seconds * 1e9 / iterations);
+   return result;
+}
+
+/***************************************************
+ * MICRO BENCH : TIME
+ * Seconds and allocations for one repetition of the body,
+ * not counting the preparation and cleanup around it
+ ***************************************************/
+MicroBench::Sample MicroBench::time(const Case& test, int iterations) const
+{
+   if (test.setup)
+      test.setup(iterations);
+
+   Sample sample;
+   {
+      AllocScope scope("MicroBench");
+      if (pCounters)
+         pCounters->start();
+      auto begin = chrono::steady_clock::now();
+      test.body(iterations);
+      sample.seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+      if (pCounters)
+         pCounters->stop();
+      sample.allocations = scope.getAllocations();
+      sample.bytes = scope.getBytes();
+   }
+   if (pCounters)
+      for (int i = 0; i < PerfCounters::NUM_EVENTS; i++)
+         sample.counters.push_back((double)pCounters->get((PerfCounters::Event)i));
+
+   if (test.teardown)
+      test.teardown(iterations);
+   return sample;
+}
+
+/***************************************************
+ * MICRO BENCH RESULT : GET MEAN
+ ***************************************************/
+double MicroBench::Result::getMean() const
+{
+   double sum = 0.0;
+   for (double sample : samples)
+      sum += sample;
+   return samples.empty() ? 0.0 : sum / samples.size();
+}
+
+/***************************************************
+ * MICRO BENCH RESULT : GET STD DEV
+ * The sample standard deviation of the repetitions
+ ***************************************************/
+double MicroBench::Result::getStdDev() const
+{
+   if (samples.size() < 2)
+      return 0.0;
+   double mean = getMean();
+   double sum = 0.0;
+   for (double sample : samples)
+      sum += (sample - mean) * (sample - mean);
+   return sqrt(sum / (samples.size() - 1));
+}
+
+/***************************************************
+ * MICRO BENCH RESULT : GET MIN
+ ***************************************************/
+double MicroBench::Result::getMin() const
+{
+   return samples.empty() ? 0.0 : *min_element(samples.begin(), samples.end());
+}
+
+/***************************************************
+ * MICRO BENCH RESULT : GET PERCENTILE
+ * Interpolated between the two nearest repetitions
+ ***************************************************/
+double MicroBench::Result::getPercentile(double percent) const
+{
+   if (samples.empty())
+      return 0.0;
+   vector<double> sorted(samples);
+   sort(sorted.begin(), sorted.end());
+   double rank = percent / 100.0 * (sorted.size() - 1);
+   size_t below = (size_t)rank;
+   if (below + 1 >= sorted.size())
+      return sorted.back();
+   return sorted[below] + (rank - below) * (sorted[below + 1] - sorted[below]);
+}
+
+/***************************************************
+ * MAKE BOARD
+ * A board from a FEN that frees its pieces when the last
+ * case holding it is done
+ ***************************************************/
+static shared_ptr<Board> makeBoard(const char* fen)
+{
+   Board* pBoard = new Board(nullptr, true /*noreset*/);
+   pBoard->readFEN(fen);
+   return shared_ptr<Board>(pBoard, [](Board* pBoard)
+   {
+      pBoard->free();
+      delete pBoard;
+   });
+}
+
+/***************************************************
+ * FIND MOVE
+ * The legal move with the given coordinates, such as "e1g1"
+ ***************************************************/
+static Move findMove(Board& board, const string& uci)
+{
+   vector<Move> moves;
+   board.getMoves(moves);
+   for (const Move& move : moves)
+      if (move.getUCI() == uci)
+         return move;
+   return Move();
+}
+
+/***************************************************
+ * ADD STANDARD CASES
+ * The hot paths of the game: setting up, moving, generating
+ * moves, parsing text, and drawing
+ ***************************************************/
+static void addStandardCases(MicroBench& bench)
+{
+   // Board::reset() frees and allocates every piece
+   shared_ptr<Board> pReset = makeBoard(FEN_INITIAL);
+   bench.add("Board::reset", [pReset](int n)
+   {
+      for (int i = 0; i < n; i++)
+         pReset->reset(true /*free*/);
+   });
+
+   // Board::move() cannot be taken back, so each iteration gets a fresh copy
+   // of a position where white has every kind of move
+   shared_ptr<Board> pSpecial = makeBoard("r3k2r/pP1p4/8/3pP3/8/8/8/R3K2R w KQkq d6 0 1");
+   shared_ptr<vector<Board*>> pCopies = make_shared<vector<Board*>>();
+   const struct { const char* name; const char* uci; } moves[] =
+   {
+      { "Board::move MOVE",         "a1b1"  },
+      { "Board::move capture",      "h1h8"  },
+      { "Board::move ENPASSANT",    "e5d6"  },
+      { "Board::move CASTLE_KING",  "e1g1"  },
+      { "Board::move CASTLE_QUEEN", "e1c1"  },
+      { "Board::move promotion",    "b7a8q" },
+   };
+   for (const auto& test : moves)
+   {
+      Move move = findMove(*pSpecial, test.uci);
+      bench.add(test.name,
+         [pSpecial, pCopies](int n)
+         {
+            for (int i = 0; i < n; i++)
+               pCopies->push_back(new Board(*pSpecial));
+         },
+         [pCopies, move](int n)
+         {
+            for (int i = 0; i < n; i++)
+               (*pCopies)[i]->move(move);
+         },
+         [pCopies](int)
+         {
+            for (Board* pBoard : *pCopies)
+            {
+               pBoard->free();
+               delete pBoard;
+            }
+            pCopies->clear();
+         },
+         4096);
+   }
+
+   // each piece's getMoves() in a busy middlegame
+   shared_ptr<Board> pKiwipete =
+      makeBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   const struct { const char* name; const char* square; } pieces[] =
+   {
+      { "King::getMoves",   "e1" },
+      { "Queen::getMoves",  "f3" },
+      { "Rook::getMoves",   "a1" },
+      { "Bishop::getMoves", "e2" },
+      { "Knight::getMoves", "e5" },
+      { "Pawn::getMoves",   "d5" },
+   };
+   for (const auto& test : pieces)
+   {
+      Position pos(test.square);
+      bench.add(test.name, [pKiwipete, pos](int n)
+      {
+         const Piece& piece = (*pKiwipete)[pos];
+         for (int i = 0; i < n; i++)
+         {
+            set<Move> possible;
+            piece.getMoves(possible, *pKiwipete);
+            MicroBench::consume(possible.size());
+         }
+      });
+   }
+
+   // the quiescence search's work at each node: the captures, and
+   // the exchange each one starts
+   bench.add("Board::generateCaptures", [pKiwipete](int n)
+   {
+      vector<Move> captures;
+      captures.reserve(256);
+      for (int i = 0; i < n; i++)
+      {
+         pKiwipete->generateCaptures(captures);
+         MicroBench::consume(captures.size());
+      }
+   });
+   shared_ptr<vector<Move>> pCaptures = make_shared<vector<Move>>();
+   pKiwipete->generateCaptures(*pCaptures);
+   bench.add("Board::see (every capture)", [pKiwipete, pCaptures](int n)
+   {
+      for (int i = 0; i < n; i++)
+         for (const Move& move : *pCaptures)
+            MicroBench::consume((size_t)pKiwipete->see(move));
+   });
+
+   // parsing the text of moves and squares
+   bench.add("Move(string)", [](int n)
+   {
+      for (int i = 0; i < n; i++)
+      {
+         Move move("e5d6E");
+         MicroBench::consume(move.getDest().getLocation());
+      }
+   });
+   bench.add("Move::read", [](int n)
+   {
+      Move move;
+      for (int i = 0; i < n; i++)
+      {
+         move.read("b7a8r");
+         MicroBench::consume(move.getDest().getLocation());
+      }
+   });
+   bench.add("Position(const char*)", [](int n)
+   {
+      for (int i = 0; i < n; i++)
+      {
+         Position pos("e4");
+         MicroBench::consume(pos.getLocation());
+      }
+   });
+
+   // drawing with no ogstream is the cost of display() apart from OpenGL
+   shared_ptr<Board> pDisplay = makeBoard(FEN_INITIAL);
+   bench.add("Board::display (null ogstream)", [pDisplay](int n)
+   {
+      set<Move> possible;
+      for (int i = 0; i < n; i++)
+         pDisplay->display(Position("e2"), Position("e2"), possible);
+   });
+}
+
+/***************************************************
+ * MICRO BENCH COMMAND
+ * Run the standard cases from the command line. --json writes
+ * a record for each case to a file, bench_output.txt by default,
+ * for "benchcompare" to check against a baseline
+ ***************************************************/
+int microBenchCommand(int argc, char** argv)
+{
+   int repetitions = 10;
+   double milliseconds = 20.0;
+   string filter;
+   string fileName;
+   string revision;
+   bool counters = false;
+   for (int i = 2; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--repetitions" && i + 1 < argc)
+         repetitions = atoi(argv[++i]);
+      else if (arg == "--time" && i + 1 < argc)
+         milliseconds = atof(argv[++i]);
+      else if (arg == "--filter" && i + 1 < argc)
+         filter = argv[++i];
+      else if (arg == "--json")
+         fileName = (i + 1 < argc && argv[i + 1][0] != '-') ? argv[++i] : "bench_output.txt";
+      else if (arg == "--revision" && i + 1 < argc)
+         revision = argv[++i];
+      else if (arg == "--counters")
+         counters = true;
+      else
+      {
+         cerr << "Usage: " << argv[0] << " microbench [--repetitions N] "
+              << "[--time ms] [--filter text] [--json [file]] [--revision text] "
+              << "[--counters]\n";
+         return 1;
+      }
+   }
+
+   MicroBench bench(repetitions, milliseconds / 1000.0);
+   unique_ptr<PerfCounters> pCounters(counters ? new PerfCounters : nullptr);
+   bench.setCounters(pCounters.get());
+   addStandardCases(bench);
+   vector<MicroBench::Result> results = bench.run(cout, filter);
+
+   if (!fileName.empty())
+   {
+      if (revision.empty())
+         revision = BenchReport::getRevision();
+      vector<BenchReport::Record> records;
+      for (const MicroBench::Result& result : results)
+      {
+         BenchReport::Record record;
+         record.name        = result.name;
+         record.revision    = revision;
+         record.iterations  = result.iterations;
+         record.repetitions = (int)result.samples.size();
+         record.median      = result.getMedian();
+         record.p95         = result.getPercentile(95.0);
+         record.mean        = result.getMean();
+         record.stdDev      = result.getStdDev();
+         record.min         = result.getMin();
+         record.allocations = result.allocations;
+         record.bytes       = result.bytes;
+         records.push_back(record);
+      }
+      ofstream fout(fileName);
+      BenchReport::write(fout, records);
+      cout << "\nWrote " << records.size() << " records for revision "
+           << revision << " to " << fileName << "\n";
+   }
+   return 0;
+}
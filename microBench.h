@@ -0,0 +1,104 @@
+/***********************************************************************
+ * Header File:
+ *    MICRO BENCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Time small operations, such as a single Board::move() or one
+ *    piece's getMoves(), in nanoseconds each. Every case is warmed up,
+ *    then timed over several repetitions so the spread can be reported.
+ *    The heap allocations of each operation are counted as well
+ ************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <iostream>
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+class TestMicroBench;
+class PerfCounters;
+
+/***************************************************
+ * MICRO BENCH
+ * A list of timed cases and the statistics of running them
+ ***************************************************/
+class MicroBench
+{
+   friend TestMicroBench;
+public:
+   // work done "iterations" times, before (untimed) or while the clock runs
+   typedef std::function<void(int iterations)> Body;
+
+   // one operation to time
+   struct Case
+   {
+      string name;
+      Body   setup;          // untimed preparation for one repetition
+      Body   body;           // the timed work
+      Body   teardown;       // untimed cleanup after one repetition
+      int    maxIterations;  // cases that prepare one object per iteration need a cap
+   };
+
+   // the nanoseconds per operation of each repetition of a case
+   struct Result
+   {
+      string name;
+      int iterations;             // operations in each repetition
+      vector<double> samples;     // nanoseconds per operation, one per repetition
+      double allocations;         // heap allocations per operation
+      double bytes;               // bytes allocated per operation
+      vector<double> counters;    // each PerfCounters event per operation, if counted
+
+      double getMean() const;
+      double getStdDev() const;
+      double getMin() const;
+      double getPercentile(double percent) const;
+      double getMedian() const { return getPercentile(50.0); }
+   };
+
+   MicroBench(int repetitions = 10, double secondsPerRepetition = 0.02) :
+      repetitions(repetitions), secondsPerRepetition(secondsPerRepetition),
+      pCounters(nullptr) {}
+
+   // also read the hardware counters around each case
+   void setCounters(PerfCounters* pCounters) { this->pCounters = pCounters; }
+
+   // add a case that needs no preparation
+   void add(const string& name, Body body);
+
+   // add a case that prepares up to maxIterations objects for each repetition
+   void add(const string& name, Body setup, Body body, Body teardown, int maxIterations);
+
+   // run every case whose name contains filter, printing a line as each finishes
+   vector<Result> run(ostream& out, const string& filter = string());
+
+   // keep the compiler from optimizing away work whose result is unused
+   static void consume(size_t value);
+
+private:
+   // one timed repetition
+   struct Sample
+   {
+      double seconds;
+      size_t allocations;
+      size_t bytes;
+      vector<double> counters;
+   };
+
+   Result run(const Case& test) const;
+   Sample time(const Case& test, int iterations) const;
+
+   vector<Case> cases;
+   int repetitions;               // timed repetitions of each case
+   double secondsPerRepetition;   // how long each repetition should take
+   PerfCounters* pCounters;       // the hardware counters, if we read them
+};
+
+// the "microbench [options]" command line mode
+int microBenchCommand(int argc, char** argv);
@@ -9,6 +9,7 @@
 
 #include "move.h"
 #include "pieceType.h"
+#include "memoryReport.h"
 #include <cassert>
 #include <iostream>
 #include <sstream>
@@ -32,7 +33,7 @@ castleQ(false), error("")
  * MOVE : STRING CONSTRUCTOR
  * Initialize a move from a text string (e.g., "e5e6")
  ***************************************************/
-Move::Move(const string& str) : text(str)
+Move::Move(const string& str) : Move()
 {
    // Use the read method to parse the string
    read(str);
@@ -104,6 +105,34 @@ void Move::read(const string& str)
       processSpecialMoveChar(str[4]);
 }
 
+/***************************************************
+ * MOVE : GET HEAP BYTES
+ ***************************************************/
+size_t Move::getHeapBytes() const
+{
+   return MemoryReport::getHeapBytes(text) + MemoryReport::getHeapBytes(error);
+}
+
+/***************************************************
+ * MOVE : GET UCI
+ * The move in long algebraic coordinates (e.g., "e7e8q"),
+ * the notation other engines use for perft and search output
+ ***************************************************/
+string Move::getUCI() const
+{
+   if (!source.isValid() || !dest.isValid())
+      return "0000";
+
+   string uci;
+   uci += (char)('a' + source.getCol());
+   uci += (char)('1' + source.getRow());
+   uci += (char)('a' + dest.getCol());
+   uci += (char)('1' + dest.getRow());
+   if (promote != SPACE && promote != INVALID)
+      uci += letterFromPieceType(promote);
+   return uci;
+}
+
 /***************************************************
  * MOVE : PROCESS SPECIAL MOVE CHAR
  * Helper method to process the special character
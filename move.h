@@ -45,8 +45,12 @@ public:
    // Methods related to move text and parsing
    void read(const string& str);
    string getText() const { return text; }
+   string getUCI() const;
    void assign(string str) { read(str); }
 
+   // bytes the text and error keep on the heap, beyond sizeof(Move)
+   size_t getHeapBytes() const;
+
    // Position getters
    Position getSrc() const { return source; }
    Position getDest() const { return dest; }
@@ -59,6 +63,7 @@ public:
    PieceType getCapture() const { return capture; }
 
    void setCapture(PieceType pt) { capture = pt; }
+   void setPromotion(PieceType pt) { promote = pt; }
 
    // Special move type getters
    bool getEnPassant() const { return enpassant; }
@@ -89,7 +94,11 @@ public:
    // Operators
    bool operator==(const Move& rhs) const { return dest == rhs.dest && source == rhs.source && dest.getLocation() == rhs.dest.getLocation() && source.getLocation() == rhs.source.getLocation(); }
    bool operator!=(const Move& rhs) const { return !(*this == rhs); }
-   bool operator<(const Move& rhs) const { return dest < rhs.dest; }
+   bool operator<(const Move& rhs) const
+   {
+      // promotions share a destination, so the piece tells them apart
+      return dest < rhs.dest || (dest == rhs.dest && promote < rhs.promote);
+   }
 
 private:
    // Helper methods
@@ -0,0 +1,205 @@
+/***********************************************************************
+ * Source File:
+ *    MOVE ORDER
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    What the search has learned about which moves to try first:
+ *    killer moves, the butterfly history, and counter-moves, and the
+ *    scores that put a node's moves in order from them
+ ************************************************************************/
+
+#include "moveOrder.h"
+#include "board.h"
+#include "search.h"
+#include "transpositionTable.h"
+#include <algorithm>
+#include <cstdlib>
+using namespace std;
+
+/***************************************************
+ * MOVE ORDER : CONSTRUCTOR
+ ***************************************************/
+MoveOrder::MoveOrder(int plies) :
+   plies(plies),
+   killers((plies + 1) * 2, 0),
+   history(2 * 64 * 64, 0),
+   counters(2 * 64 * 64, 0)
+{
+}
+
+/***************************************************
+ * MOVE ORDER : CLEAR
+ ***************************************************/
+void MoveOrder::clear()
+{
+   fill(killers.begin(), killers.end(), 0);
+   fill(history.begin(), history.end(), 0);
+   fill(counters.begin(), counters.end(), 0);
+}
+
+/***************************************************
+ * MOVE ORDER : NEW SEARCH
+ ***************************************************/
+void MoveOrder::newSearch()
+{
+   fill(killers.begin(), killers.end(), 0);
+   for (int& entry : history)
+      entry /= 2;
+}
+
+/***************************************************
+ * MOVE ORDER : MVV LVA
+ * The victim's value, with the attacker breaking ties:
+ * a pawn first and the king last. A promotion counts
+ * what the pawn becomes
+ ***************************************************/
+int MoveOrder::mvvLva(const Board& board, const Move& move)
+{
+   static const int ATTACKER[8] = { 0, 0, 6, 5, 4, 3, 2, 1 };
+   PieceType attacker = board.board[move.getSrc().getCol()][move.getSrc().getRow()]->getType();
+   return Search::gain(move) * 8 - ATTACKER[attacker];
+}
+
+/***************************************************
+ * MOVE ORDER : PREVIOUS
+ * The butterfly index of the move that led here, with the
+ * color of the side now to move, or -1 at the start
+ ***************************************************/
+int MoveOrder::previous(const Board& board)
+{
+   if (board.history.empty())
+      return -1;
+   const Board::Undo& undo = board.history.back();
+   return (board.whiteTurn() ? 0 : 4096) + square(undo.source) * 64 + square(undo.dest);
+}
+
+/***************************************************
+ * MOVE ORDER : SCORE
+ ***************************************************/
+bool MoveOrder::score(const Board& board, const vector<Move>& list, vector<int>& scores,
+                      int ply, const Move* pPV, uint16_t hashMove) const
+{
+   bool white = board.whiteTurn();
+   uint16_t killer0 = killers[ply * 2];
+   uint16_t killer1 = killers[ply * 2 + 1];
+   int last = previous(board);
+   uint16_t counter = last < 0 ? 0 : counters[last];
+
+   bool foundPV = false;
+   scores.resize(list.size());
+   for (size_t i = 0; i < list.size(); i++)
+   {
+      const Move& move = list[i];
+      uint16_t packed = TranspositionTable::pack(move);
+      int& value = scores[i];
+      if (pPV && move == *pPV && move.getPromotion() == pPV->getPromotion())
+      {
+         value = PV;
+         foundPV = true;
+      }
+      else if (packed == hashMove)
+         value = HASH;
+      else if (!isQuiet(move))
+         value = (board.seeGE(move, 0) ? CAPTURE : BAD_CAPTURE) + mvvLva(board, move);
+      else if (packed == killer0)
+         value = KILLER + 1;
+      else if (packed == killer1)
+         value = KILLER;
+      else if (packed == counter)
+         value = COUNTER;
+      else
+         value = history[butterfly(white, move)];
+   }
+   return foundPV;
+}
+
+/***************************************************
+ * MOVE ORDER : SCORE CAPTURES
+ ***************************************************/
+void MoveOrder::scoreCaptures(const Board& board, const vector<Move>& list, vector<int>& scores)
+{
+   scores.resize(list.size());
+   for (size_t i = 0; i < list.size(); i++)
+      scores[i] = mvvLva(board, list[i]);
+}
+
+/***************************************************
+ * MOVE ORDER : PICK
+ * One step of a selection sort, so a node that cuts off
+ * early never pays to sort the moves it does not try
+ ***************************************************/
+void MoveOrder::pick(vector<Move>& list, vector<int>& scores, size_t i)
+{
+   size_t best = i;
+   for (size_t j = i + 1; j < list.size(); j++)
+      if (scores[j] > scores[best])
+         best = j;
+   if (best != i)
+   {
+      swap(list[i], list[best]);
+      swap(scores[i], scores[best]);
+   }
+}
+
+/***************************************************
+ * MOVE ORDER : SORT
+ ***************************************************/
+void MoveOrder::sort(vector<Move>& list, vector<int>& scores, size_t first)
+{
+   for (size_t i = first; i + 1 < list.size(); i++)
+      pick(list, scores, i);
+}
+
+/***************************************************
+ * MOVE ORDER : GRAVITY
+ * Move an entry toward the bonus by less the nearer it
+ * already is to the limit, so it stays within HISTORY_MAX
+ * and old lessons fade as new ones come
+ ***************************************************/
+void MoveOrder::gravity(int& entry, int bonus)
+{
+   entry += bonus - entry * abs(bonus) / HISTORY_MAX;
+}
+
+/***************************************************
+ * MOVE ORDER : UPDATE
+ ***************************************************/
+void MoveOrder::update(const Board& board, const vector<Move>& list, size_t iBest, int ply, int depth)
+{
+   const Move& best = list[iBest];
+   if (!isQuiet(best))
+      return;
+
+   uint16_t packed = TranspositionTable::pack(best);
+   if (ply <= plies && killers[ply * 2] != packed)
+   {
+      killers[ply * 2 + 1] = killers[ply * 2];
+      killers[ply * 2] = packed;
+   }
+
+   int last = previous(board);
+   if (last >= 0)
+      counters[last] = packed;
+
+   bool white = board.whiteTurn();
+   int bonus = min(depth * depth * 16, HISTORY_MAX / 4);
+   gravity(history[butterfly(white, best)], bonus);
+   for (size_t i = 0; i < iBest; i++)
+      if (isQuiet(list[i]))
+         gravity(history[butterfly(white, list[i])], -bonus);
+}
+
+/***************************************************
+ * MOVE ORDER : GET HISTORY and GET COUNTER
+ ***************************************************/
+int MoveOrder::getHistory(bool white, const Move& move) const
+{
+   return history[butterfly(white, move)];
+}
+
+uint16_t MoveOrder::getCounter(const Board& board) const
+{
+   int last = previous(board);
+   return last < 0 ? 0 : counters[last];
+}
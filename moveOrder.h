@@ -0,0 +1,104 @@
+/***********************************************************************
+ * Header File:
+ *    MOVE ORDER
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    What the search has learned about which moves to try first:
+ *    killer moves, the butterfly history, and counter-moves, and the
+ *    scores that put a node's moves in order from them
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "move.h"
+
+using std::vector;
+
+class Board;
+class TestMoveOrder;
+
+/***************************************************
+ * MOVE ORDER
+ * One for each thread that searches, since the tables change at
+ * nearly every node. Moves are kept packed, as the transposition
+ * table keeps them. In order, a node tries: the last iteration's
+ * line, the move the table remembers, the captures that do not
+ * lose material by most valuable victim and least valuable
+ * attacker, the two killers of its ply, the counter to the move
+ * just played, the other quiet moves by history, and last the
+ * captures that lose material
+ ***************************************************/
+class MoveOrder
+{
+   friend TestMoveOrder;
+public:
+   static const int HISTORY_MAX = 16384;   // history stays within plus or minus this
+
+   // the score bands, best first. Quiet moves fall between COUNTER
+   // and BAD_CAPTURE by their history
+   static const int PV          = 40000000;
+   static const int HASH        = 30000000;
+   static const int CAPTURE     = 20000000;
+   static const int KILLER      = 10000000;
+   static const int COUNTER     =  9000000;
+   static const int BAD_CAPTURE = -20000000;
+
+   // killers for plies 0 through plies
+   MoveOrder(int plies);
+
+   // forget everything
+   void clear();
+
+   // a new search: the killers are forgotten, and the history counts
+   // for half, so what the last search learned still helps
+   void newSearch();
+
+   // score each move of a node into scores, which is resized to match.
+   // Returns whether the move in pPV, if any, was among them
+   bool score(const Board& board, const vector<Move>& list, vector<int>& scores,
+              int ply, const Move* pPV, uint16_t hashMove) const;
+
+   // score the moves of a quiescence node by MVV-LVA alone
+   static void scoreCaptures(const Board& board, const vector<Move>& list, vector<int>& scores);
+
+   // bring the best scored of the moves from i on to i, or put every
+   // move from first on in order
+   static void pick(vector<Move>& list, vector<int>& scores, size_t i);
+   static void sort(vector<Move>& list, vector<int>& scores, size_t first);
+
+   // list[iBest] caused a cutoff at ply with depth left. A quiet one
+   // becomes a killer and the counter to the last move, and gains
+   // history; the quiet moves tried before it lose history
+   void update(const Board& board, const vector<Move>& list, size_t iBest, int ply, int depth);
+
+   // victim first, then attacker: the larger, the sooner to try
+   static int mvvLva(const Board& board, const Move& move);
+
+   // neither a capture nor a promotion
+   static bool isQuiet(const Move& move)
+   {
+      return move.getCapture() == SPACE && move.getPromotion() == SPACE;
+   }
+
+   // what is learned, for the tests
+   int      getHistory(bool white, const Move& move) const;
+   uint16_t getKiller(int ply, int slot) const { return killers[ply * 2 + slot]; }
+   uint16_t getCounter(const Board& board) const;
+
+private:
+   static int square(const Position& pos) { return pos.getCol() * 8 + pos.getRow(); }
+   static int butterfly(bool white, const Move& move)
+   {
+      return (white ? 0 : 4096) + square(move.getSrc()) * 64 + square(move.getDest());
+   }
+   static int previous(const Board& board);
+   static void gravity(int& entry, int bonus);
+
+   int plies;
+   vector<uint16_t> killers;     // two per ply, the newer first
+   vector<int>      history;     // [color][from][to]
+   vector<uint16_t> counters;    // [color][from][to] of the last move
+};
@@ -0,0 +1,184 @@
+/***********************************************************************
+ * Source File:
+ *    PERF COUNTERS
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The CPU's hardware counters (cycles, instructions, cache and
+ *    branch misses) around a piece of work, read through Linux's
+ *    perf_event_open(). Elsewhere, or when the kernel or a virtual
+ *    machine does not allow it, the counters are simply unavailable
+ ************************************************************************/
+
+#include "perfCounters.h"
+#include <iomanip>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+/***************************************************
+ * PERF COUNTERS : CONSTRUCTOR
+ * Open each event on its own, so a CPU without one of
+ * them still gives us the rest
+ ***************************************************/
+PerfCounters::PerfCounters()
+{
+   for (int i = 0; i < NUM_EVENTS; i++)
+   {
+      fd[i] = -1;
+      value[i] = 0;
+   }
+
+#ifdef __linux__
+   const struct { uint32_t type; uint64_t config; } events[NUM_EVENTS] =
+   {
+      { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+      { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+      { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                            (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+      { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+      { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+   };
+   for (int i = 0; i < NUM_EVENTS; i++)
+   {
+      perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = events[i].type;
+      attr.config = events[i].config;
+      attr.disabled = 1;
+      attr.inherit = 1;          // threads started later are counted too
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      fd[i] = (int)syscall(SYS_perf_event_open, &attr, 0 /*this thread*/, -1 /*any cpu*/,
+                           -1 /*no group*/, 0);
+   }
+#endif
+}
+
+/***************************************************
+ * PERF COUNTERS : DESTRUCTOR
+ ***************************************************/
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+   for (int i = 0; i < NUM_EVENTS; i++)
+      if (fd[i] >= 0)
+         close(fd[i]);
+#endif
+}
+
+/***************************************************
+ * PERF COUNTERS : IS ANY AVAILABLE
+ ***************************************************/
+bool PerfCounters::isAnyAvailable() const
+{
+   for (int i = 0; i < NUM_EVENTS; i++)
+      if (fd[i] >= 0)
+         return true;
+   return false;
+}
+
+/***************************************************
+ * PERF COUNTERS : START
+ ***************************************************/
+void PerfCounters::start()
+{
+#ifdef __linux__
+   for (int i = 0; i < NUM_EVENTS; i++)
+      if (fd[i] >= 0)
+      {
+         ioctl(fd[i], PERF_EVENT_IOC_RESET, 0);
+         ioctl(fd[i], PERF_EVENT_IOC_ENABLE, 0);
+      }
+#endif
+}
+
+/***************************************************
+ * PERF COUNTERS : STOP
+ * When there are more events than counters the kernel takes
+ * turns, so scale each count by the share of time it ran
+ ***************************************************/
+void PerfCounters::stop()
+{
+#ifdef __linux__
+   for (int i = 0; i < NUM_EVENTS; i++)
+   {
+      value[i] = 0;
+      if (fd[i] < 0)
+         continue;
+      ioctl(fd[i], PERF_EVENT_IOC_DISABLE, 0);
+      uint64_t data[3] = { 0, 0, 0 };   // value, time enabled, time running
+      if (read(fd[i], data, sizeof(data)) != (ssize_t)sizeof(data))
+         continue;
+      value[i] = (data[2] == 0 || data[2] >= data[1]) ? data[0] :
+                 (uint64_t)((double)data[0] * data[1] / data[2]);
+   }
+#endif
+}
+
+/***************************************************
+ * PERF COUNTERS : GET IPC
+ ***************************************************/
+double PerfCounters::getIPC() const
+{
+   if (!isAvailable(CYCLES) || !isAvailable(INSTRUCTIONS) || value[CYCLES] == 0)
+      return 0.0;
+   return (double)value[INSTRUCTIONS] / value[CYCLES];
+}
+
+/***************************************************
+ * PERF COUNTERS : GET NAME
+ ***************************************************/
+const char* PerfCounters::getName(Event event)
+{
+   const char* names[NUM_EVENTS] =
+   {
+      "Cycles", "Instructions", "L1D misses", "LLC misses", "Branch misses"
+   };
+   return names[event];
+}
+
+/***************************************************
+ * PERF COUNTERS : REPORT
+ * In the same "Name: value" form as the perft summary, every
+ * label padded to the widest, so the values line up
+ ***************************************************/
+void PerfCounters::report(ostream& out, uint64_t units, const char* unit) const
+{
+   ios::fmtflags flags = out.flags();
+   streamsize precision = out.precision();
+
+   // the name, its colon, and at least one space
+   size_t width = 0;
+   for (int i = 0; i < NUM_EVENTS; i++)
+      width = max(width, string(getName((Event)i)).size() + 2);
+
+   for (int i = 0; i < NUM_EVENTS; i++)
+   {
+      string label = string(getName((Event)i)) + ":";
+      out << left << setw(width) << label << right;
+      if (!isAvailable((Event)i))
+         out << "n/a\n";
+      else
+         out << value[i] << "  (" << fixed << setprecision(2)
+             << (units ? (double)value[i] / units : 0.0) << " per " << unit << ")\n";
+      out.flags(flags);
+   }
+   out << left << setw(width) << "IPC:" << right;
+   if (isAvailable(CYCLES) && isAvailable(INSTRUCTIONS))
+      out << fixed << setprecision(2) << getIPC() << "\n";
+   else
+      out << "n/a\n";
+   out.flags(flags);
+   out.precision(precision);
+}
@@ -0,0 +1,56 @@
+/***********************************************************************
+ * Header File:
+ *    PERF COUNTERS
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The CPU's hardware counters (cycles, instructions, cache and
+ *    branch misses) around a piece of work, read through Linux's
+ *    perf_event_open(). Elsewhere, or when the kernel or a virtual
+ *    machine does not allow it, the counters are simply unavailable
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+
+using std::ostream;
+
+/***************************************************
+ * PERF COUNTERS
+ * Counts for this thread, and for any thread it starts
+ * after the counters are constructed
+ ***************************************************/
+class PerfCounters
+{
+public:
+   enum Event { CYCLES, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, NUM_EVENTS };
+
+   PerfCounters();
+   ~PerfCounters();
+   PerfCounters(const PerfCounters&) = delete;
+   PerfCounters& operator = (const PerfCounters&) = delete;
+
+   bool isAvailable(Event event) const { return fd[event] >= 0; }
+   bool isAnyAvailable() const;
+
+   // count from zero between start() and stop()
+   void start();
+   void stop();
+
+   // the count at the last stop(), scaled up if the kernel had to share the counter
+   uint64_t get(Event event) const { return value[event]; }
+
+   // instructions per cycle, 0 if either is unavailable
+   double getIPC() const;
+
+   static const char* getName(Event event);
+
+   // the counts, the IPC, and each miss count per unit of work
+   void report(ostream& out, uint64_t units, const char* unit) const;
+
+private:
+   int fd[NUM_EVENTS];          // -1 when the event could not be opened
+   uint64_t value[NUM_EVENTS];
+};
@@ -0,0 +1,358 @@
+/***********************************************************************
+ * Source File:
+ *    PERFT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Count the leaf nodes of the move tree to a fixed depth. This is
+ *    the standard correctness and speed test for a move generator
+ ************************************************************************/
+
+#include "perft.h"
+#include "board.h"
+#include "threadPool.h"
+#include "perftTable.h"
+#include "perfCounters.h"
+#include "trace.h"
+#include "memoryReport.h"
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+using namespace std;
+
+/***************************************************
+ * PERFT : COUNT
+ * Number of leaf nodes depth plies from here
+ ***************************************************/
+uint64_t Perft::count(int depth)
+{
+   TRACE_SCOPE("Perft::count");
+   if (depth <= 0)
+      return 1;
+   if ((int)moves.size() < depth)
+      moves.resize(depth);
+   return count(depth, 0);
+}
+
+/***************************************************
+ * PERFT : COUNT
+ * Recursively make each legal move, count below it, and take it back.
+ * The last ply is where nearly all the nodes are, so there we can
+ * count moves rather than make them. Board::getMoves() makes and takes
+ * back every pseudo-legal move to test it, so it is left to difftest
+ * as the reference; the moves here come from Board::generateMoves()
+ ***************************************************/
+uint64_t Perft::count(int depth, int ply)
+{
+   if (depth == 1 && fast)
+      return board.countMoves();
+
+   // below the last ply the hash is more work than the count
+   uint64_t key = 0;
+   uint64_t nodes = 0;
+   if (pTable && depth >= 2)
+   {
+      key = board.getHash();
+      if (pTable->probe(key, depth, nodes))
+         return nodes;
+   }
+
+   vector<Move>& list = moves[ply];
+   board.generateMoves(list);
+   if (depth == 1 && bulk)
+      return list.size();
+
+   for (const Move& move : list)
+   {
+      board.makeMove(move);
+      nodes += (depth == 1) ? 1 : count(depth - 1, ply + 1);
+      board.undoMove();
+   }
+
+   if (pTable && depth >= 2)
+      pTable->store(key, depth, nodes);
+   return nodes;
+}
+
+/***************************************************
+ * PERFT : DIVIDE
+ * Report the count below each root move, then the total
+ ***************************************************/
+uint64_t Perft::divide(int depth, ostream& out)
+{
+   TRACE_SCOPE("Perft::divide");
+   if (depth <= 0)
+      return 1;
+   if ((int)moves.size() < depth)
+      moves.resize(depth);
+
+   vector<Move> root;
+   board.generateMoves(root);
+
+   uint64_t nodes = 0;
+   for (const Move& move : root)
+   {
+      board.makeMove(move);
+      uint64_t below = (depth == 1) ? 1 : count(depth - 1, 1);
+      board.undoMove();
+
+      out << move.getUCI() << ": " << below << "\n";
+      nodes += below;
+   }
+   return nodes;
+}
+
+/***************************************************
+ * PERFT : COUNT PARALLEL
+ * Number of leaf nodes, counted by a pool of threads
+ ***************************************************/
+uint64_t Perft::countParallel(int depth, int threads, int split)
+{
+   TRACE_SCOPE("Perft::countParallel");
+   vector<Move> root;
+   vector<uint64_t> below;
+   return parallel(depth, threads, split, root, below);
+}
+
+/***************************************************
+ * PERFT : DIVIDE PARALLEL
+ * Report the count below each root move, counted by a pool of threads
+ ***************************************************/
+uint64_t Perft::divideParallel(int depth, int threads, int split, ostream& out)
+{
+   TRACE_SCOPE("Perft::divideParallel");
+   vector<Move> root;
+   vector<uint64_t> below;
+   uint64_t nodes = parallel(depth, threads, split, root, below);
+   for (size_t i = 0; i < root.size(); i++)
+      out << root[i].getUCI() << ": " << below[i] << "\n";
+   return nodes;
+}
+
+/***************************************************
+ * PERFT : PARALLEL
+ * Every line of play split plies deep becomes one task. Each worker
+ * has its own copy of the board to play the line out and count below it
+ ***************************************************/
+uint64_t Perft::parallel(int depth, int threads, int split,
+                         vector<Move>& root, vector<uint64_t>& below)
+{
+   root.clear();
+   below.clear();
+   if (depth <= 0)
+      return 1;
+
+   board.generateMoves(root);
+   below.assign(root.size(), 0);
+   if (depth == 1)
+   {
+      below.assign(root.size(), 1);
+      return root.size();
+   }
+
+   if (threads < 1)
+      threads = 1;
+   if (split < 1)
+      split = 1;
+   if (split > depth - 1)
+      split = depth - 1;
+
+   // every worker gets its own board, made before any task can run
+   vector<unique_ptr<Board>> boards;
+   vector<unique_ptr<Perft>> workers;
+   for (int i = 0; i < threads; i++)
+   {
+      boards.push_back(unique_ptr<Board>(new Board(board)));
+      workers.push_back(unique_ptr<Perft>(new Perft(*boards.back(), bulk, fast, pTable)));
+   }
+
+   vector<atomic<uint64_t>> counts(root.size());
+   for (atomic<uint64_t>& count : counts)
+      count = 0;
+
+   {
+      ThreadPool pool(threads);
+      vector<Move> path;
+      for (size_t i = 0; i < root.size(); i++)
+      {
+         path.assign(1, root[i]);
+         board.makeMove(root[i]);
+         submit(pool, workers, path, split - 1, depth - 1, counts[i]);
+         board.undoMove();
+      }
+      pool.wait();
+   }
+
+   uint64_t nodes = 0;
+   for (size_t i = 0; i < root.size(); i++)
+   {
+      below[i] = counts[i];
+      nodes += below[i];
+   }
+
+   for (unique_ptr<Board>& pBoard : boards)
+      pBoard->free();
+   return nodes;
+}
+
+/***************************************************
+ * PERFT : SUBMIT
+ * Walk split more plies down the tree on our board, then hand each
+ * line of play to the pool to count depth plies below it
+ ***************************************************/
+void Perft::submit(ThreadPool& pool, vector<unique_ptr<Perft>>& workers,
+                   vector<Move>& path, int split, int depth,
+                   atomic<uint64_t>& below)
+{
+   if (split == 0 || depth == 0)
+   {
+      pool.submit([&workers, &below, path, depth](int worker)
+      {
+         Perft& perft = *workers[worker];
+         for (const Move& move : path)
+            perft.board.makeMove(move);
+         below += perft.count(depth);
+         for (size_t i = 0; i < path.size(); i++)
+            perft.board.undoMove();
+      });
+      return;
+   }
+
+   vector<Move> list;
+   board.generateMoves(list);
+   for (const Move& move : list)
+   {
+      path.push_back(move);
+      board.makeMove(move);
+      submit(pool, workers, path, split - 1, depth - 1, below);
+      board.undoMove();
+      path.pop_back();
+   }
+}
+
+/***************************************************
+ * PERFT : MEMORY REPORT
+ * The lists are kept from one count to the next, so
+ * each holds as much as its ply ever needed
+ ***************************************************/
+void Perft::memoryReport(MemoryReport& report) const
+{
+   size_t bytes = sizeof(Perft) + moves.capacity() * sizeof(vector<Move>);
+   for (const vector<Move>& list : moves)
+      bytes += MemoryReport::getHeapBytes(list);
+   report.add("Moves", "Perft move lists", moves.size(), bytes);
+}
+
+/***************************************************
+ * PERFT COMMAND
+ * chess perft <depth> [options] [FEN]
+ *    --no-bulk    make every leaf move instead of counting the move list
+ *    --fast       count the leaves with Board::countMoves()
+ *    --threads N  count on N threads
+ *    --split N    split the tree into tasks N plies below the root
+ *    --scaling    time 1, 2, 4, ... N threads and report the speedup
+ *    --hash MB    remember counts in a table of MB megabytes
+ ***************************************************/
+int perftCommand(int argc, char** argv)
+{
+   if (argc < 3)
+   {
+      cerr << "Usage: " << argv[0] << " perft <depth> [--no-bulk] [--fast] "
+           << "[--threads N] [--split N] [--scaling] [--hash MB] [--counters] [FEN]\n";
+      return 1;
+   }
+   int depth = atoi(argv[2]);
+   bool bulk = true;
+   bool fast = false;
+   bool scaling = false;
+   bool counters = false;
+   int threads = 1;
+   int split = 2;
+   int megabytes = 0;
+
+   // the FEN has spaces in it, so it may arrive as several arguments
+   string fen;
+   for (int i = 3; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--no-bulk")
+         bulk = false;
+      else if (arg == "--fast")
+         fast = true;
+      else if (arg == "--scaling")
+         scaling = true;
+      else if (arg == "--counters")
+         counters = true;
+      else if (arg == "--threads" && i + 1 < argc)
+         threads = atoi(argv[++i]);
+      else if (arg == "--split" && i + 1 < argc)
+         split = atoi(argv[++i]);
+      else if (arg == "--hash" && i + 1 < argc)
+         megabytes = atoi(argv[++i]);
+      else
+         fen += (fen.empty() ? "" : " ") + arg;
+   }
+   if (fen.empty())
+      fen = FEN_INITIAL;
+
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(fen);
+   unique_ptr<PerftTable> pTable(megabytes > 0 ? new PerftTable(megabytes) : nullptr);
+   Perft perft(board, bulk, fast, pTable.get());
+
+   // the same count on 1, 2, 4, ... threads, each compared with one thread
+   if (scaling)
+   {
+      cout << "Threads        Nodes     Seconds  Nodes/second  Speedup\n";
+      double secondsOne = 0.0;
+      uint64_t nodesOne = 0;
+      for (int n = 1; n <= threads; n = (n * 2 > threads && n < threads) ? threads : n * 2)
+      {
+         // each run starts from an empty table
+         if (pTable)
+            pTable->clear();
+         auto begin = chrono::steady_clock::now();
+         uint64_t nodes = perft.countParallel(depth, n, split);
+         double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+         if (n == 1)
+         {
+            secondsOne = seconds;
+            nodesOne = nodes;
+         }
+         cout << setw(7) << n << setw(13) << nodes
+              << fixed << setprecision(3) << setw(12) << seconds
+              << setw(14) << (uint64_t)(seconds > 0.0 ? nodes / seconds : 0.0)
+              << setprecision(2) << setw(9) << (seconds > 0.0 ? secondsOne / seconds : 0.0)
+              << (nodes == nodesOne ? "" : "  MISMATCH") << "\n";
+      }
+      board.free();
+      return 0;
+   }
+
+   // opened before the worker threads start so they are counted as well
+   unique_ptr<PerfCounters> pCounters(counters ? new PerfCounters : nullptr);
+   if (pCounters)
+      pCounters->start();
+
+   auto begin = chrono::steady_clock::now();
+   uint64_t nodes = (threads > 1) ? perft.divideParallel(depth, threads, split, cout)
+                                  : perft.divide(depth, cout);
+   double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+   if (pCounters)
+      pCounters->stop();
+
+   cout << "\nPosition:     " << board.getFEN() << "\n"
+        << "Depth:        " << depth << "\n"
+        << "Threads:      " << threads << "\n"
+        << "Hash:         " << (pTable ? pTable->describe() : string("none")) << "\n"
+        << "Nodes:        " << nodes << "\n"
+        << "Time:         " << seconds << " s\n"
+        << "Nodes/second: " << (uint64_t)(seconds > 0.0 ? nodes / seconds : 0.0) << "\n";
+   if (pCounters)
+      pCounters->report(cout, nodes, "node");
+
+   board.free();
+   return 0;
+}
@@ -0,0 +1,69 @@
+/***********************************************************************
+ * Header File:
+ *    PERFT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Count the leaf nodes of the move tree to a fixed depth. This is
+ *    the standard correctness and speed test for a move generator
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <iostream>
+#include "move.h"
+
+using std::vector;
+
+class Board;
+class ThreadPool;
+class PerftTable;
+class TestPerft;
+class MemoryReport;
+
+/***************************************************
+ * PERFT
+ * Walk every legal move of a board to a given depth
+ ***************************************************/
+class Perft
+{
+   friend TestPerft;
+public:
+   Perft(Board& board, bool bulk = true, bool fast = false, PerftTable* pTable = nullptr) :
+      board(board), bulk(bulk), fast(fast), pTable(pTable) {}
+
+   // number of leaf nodes depth plies from the current position
+   uint64_t count(int depth);
+
+   // the count for each root move followed by the total
+   uint64_t divide(int depth, ostream& out);
+
+   // the same, with the tree split split plies below the root into
+   // tasks that run on a work-stealing pool of threads
+   uint64_t countParallel(int depth, int threads, int split);
+   uint64_t divideParallel(int depth, int threads, int split, ostream& out);
+
+   // the move list for each ply
+   void memoryReport(MemoryReport& report) const;
+
+private:
+   uint64_t count(int depth, int ply);
+   uint64_t parallel(int depth, int threads, int split,
+                     vector<Move>& root, vector<uint64_t>& below);
+   void     submit(ThreadPool& pool, vector<std::unique_ptr<Perft>>& workers,
+                   vector<Move>& path, int split, int depth,
+                   std::atomic<uint64_t>& below);
+
+   Board& board;
+   bool bulk;                    // count the last ply from the move list size
+   bool fast;                    // count the last ply with Board::countMoves()
+   PerftTable* pTable;           // counts already known, shared by all threads
+   vector<vector<Move>> moves;   // one move list per ply so nothing is reallocated
+};
+
+// the "perft <depth> [options] [FEN]" command line mode
+int perftCommand(int argc, char** argv);
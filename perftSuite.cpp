@@ -0,0 +1,202 @@
+/***********************************************************************
+ * Source File:
+ *    PERFT SUITE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The standard perft positions with their published node counts.
+ *    Running them all is the regression test for the move generators,
+ *    and the time each takes is the baseline for their speed
+ ************************************************************************/
+
+#include "perftSuite.h"
+#include "perft.h"
+#include "perftTable.h"
+#include "board.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <cstdlib>
+using namespace std;
+
+/***************************************************
+ * PERFT SUITE : GET CASES
+ * The well-known positions from the chess programming community,
+ * followed by small endgames that each corner one special rule.
+ * Castling out of or through check fails kiwipete, positions 4
+ * and 5, and both castling endgames; queen-only promotion fails
+ * positions 4 and 5 and the promotion endgames; en passant from
+ * the wrong rank fails kiwipete, position 3, and both illegal en
+ * passant endgames
+ ***************************************************/
+const vector<PerftSuite::Case>& PerftSuite::getCases()
+{
+   static const vector<Case> cases =
+   {
+      { "initial", FEN_INITIAL,
+        { 20, 400, 8902, 197281, 4865609, 119060324 } },
+      { "kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        { 48, 2039, 97862, 4085603, 193690690 } },
+      { "position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        { 14, 191, 2812, 43238, 674624, 11030083 } },
+      { "position 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        { 6, 264, 9467, 422333, 15833292 } },
+      { "position 4 mirrored", "r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1",
+        { 6, 264, 9467, 422333, 15833292 } },
+      { "position 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+        { 44, 1486, 62379, 2103487, 89941194 } },
+      { "position 6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+        { 46, 2079, 89890, 3894594, 164075551 } },
+      { "illegal en passant 1", "3k4/3p4/8/K1P4r/8/8/8/8 b - - 0 1",
+        { 18, 92, 1670, 10138, 185429, 1134888 } },
+      { "illegal en passant 2", "8/8/4k3/8/2p5/8/B2P2K1/8 w - - 0 1",
+        { 13, 102, 1266, 10276, 135655, 1015133 } },
+      { "en passant gives check", "8/8/1k6/2b5/2pP4/8/5K2/8 b - d3 0 1",
+        { 15, 126, 1928, 13931, 206379, 1440467 } },
+      { "short castle gives check", "5k2/8/8/8/8/8/8/4K2R w K - 0 1",
+        { 15, 66, 1198, 6399, 120330, 661072 } },
+      { "long castle gives check", "3k4/8/8/8/8/8/8/R3K3 w Q - 0 1",
+        { 16, 71, 1286, 7418, 141077, 803711 } },
+      { "castling rights", "r3k2r/1b4bq/8/8/8/8/7B/R3K2R w KQkq - 0 1",
+        { 26, 1141, 27826, 1274206 } },
+      { "castling prevented", "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - 0 1",
+        { 44, 1494, 50509, 1720476 } },
+      { "promote out of check", "2K2r2/4P3/8/8/8/8/8/3k4 w - - 0 1",
+        { 11, 133, 1442, 19174, 266199, 3821001 } },
+      { "discovered check", "8/8/1P2K3/8/2n5/1q6/8/5k2 b - - 0 1",
+        { 29, 165, 5160, 31961, 1004658 } },
+      { "promote to give check", "4k3/1P6/8/8/8/8/K7/8 w - - 0 1",
+        { 9, 40, 472, 2661, 38983, 217342 } },
+      { "underpromote to check", "8/P1k5/K7/8/8/8/8/8 w - - 0 1",
+        { 6, 27, 273, 1329, 18135, 92683 } },
+      { "self stalemate", "K1k5/8/P7/8/8/8/8/8 w - - 0 1",
+        { 2, 6, 13, 63, 382, 2217 } },
+      { "stalemate and checkmate 1", "8/k1P5/8/1K6/8/8/8/8 w - - 0 1",
+        { 10, 25, 268, 926, 10857, 43261, 567584 } },
+      { "stalemate and checkmate 2", "8/8/2k5/5q2/5n2/8/5K2/8 b - - 0 1",
+        { 37, 183, 6559, 23527 } },
+   };
+   return cases;
+}
+
+/***************************************************
+ * PERFT SUITE : RUN
+ * Count every position, printing a line as each finishes
+ ***************************************************/
+vector<PerftSuite::Result> PerftSuite::run(ostream& out) const
+{
+   vector<Result> results;
+   out << left << setw(28) << "Position" << right << setw(6) << "Depth"
+       << setw(12) << "Nodes" << setw(10) << "Seconds" << setw(14) << "Nodes/second"
+       << "  Result\n";
+   for (const Case& test : getCases())
+   {
+      Result result = run(test);
+      out << left << setw(28) << result.name << right << setw(6) << result.depth
+          << setw(12) << result.nodes
+          << fixed << setprecision(3) << setw(10) << result.seconds
+          << setw(14) << result.getNPS()
+          << (result.passed() ? "  pass" : "  FAIL, expected ");
+      if (!result.passed())
+         out << result.expected;
+      out << endl;
+      results.push_back(result);
+   }
+   return results;
+}
+
+/***************************************************
+ * PERFT SUITE : RUN
+ * Count one position to the deepest depth within maxNodes
+ ***************************************************/
+PerftSuite::Result PerftSuite::run(const Case& test) const
+{
+   Result result;
+   result.name = test.name;
+   result.depth = 1;
+   for (int d = 1; d <= (int)test.nodes.size(); d++)
+      if (test.nodes[d - 1] <= maxNodes)
+         result.depth = d;
+   result.expected = test.nodes[result.depth - 1];
+
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(test.fen);
+   unique_ptr<PerftTable> pTable(megabytes > 0 ? new PerftTable(megabytes) : nullptr);
+   Perft perft(board, true /*bulk*/, fast, pTable.get());
+
+   auto begin = chrono::steady_clock::now();
+   result.nodes = (threads > 1) ? perft.countParallel(result.depth, threads, 2 /*split*/)
+                                : perft.count(result.depth);
+   result.seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+   board.free();
+   return result;
+}
+
+/***************************************************
+ * PERFT SUITE COMMAND
+ * Run the suite from the command line. The exit code is the number
+ * of positions that failed, so a build can stop on a bad generator.
+ * --output appends one tab-separated line per position to a file,
+ * which keeps a history of the timings to compare against
+ ***************************************************/
+int perftSuiteCommand(int argc, char** argv)
+{
+   PerftSuite suite;
+   string fileName;
+   int threads = 1;
+   int megabytes = 0;
+   for (int i = 2; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--fast")
+         suite.setFast(true);
+      else if (arg == "--full")
+         suite.setMaxNodes(UINT64_MAX);
+      else if (arg == "--max-nodes" && i + 1 < argc)
+         suite.setMaxNodes(strtoull(argv[++i], nullptr, 10));
+      else if (arg == "--threads" && i + 1 < argc)
+         threads = atoi(argv[++i]);
+      else if (arg == "--hash" && i + 1 < argc)
+         megabytes = atoi(argv[++i]);
+      else if (arg == "--output" && i + 1 < argc)
+         fileName = argv[++i];
+      else
+      {
+         cerr << "Usage: " << argv[0] << " perftsuite [--fast] [--full] [--max-nodes N] "
+              << "[--threads N] [--hash MB] [--output file]\n";
+         return 1;
+      }
+   }
+   suite.setThreads(threads);
+   suite.setHash(megabytes);
+
+   auto begin = chrono::steady_clock::now();
+   vector<PerftSuite::Result> results = suite.run(cout);
+   double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+   int failed = 0;
+   uint64_t nodes = 0;
+   for (const PerftSuite::Result& result : results)
+   {
+      failed += result.passed() ? 0 : 1;
+      nodes += result.nodes;
+   }
+   cout << "\nPassed:       " << results.size() - failed << " of " << results.size() << "\n"
+        << "Nodes:        " << nodes << "\n"
+        << "Time:         " << seconds << " s\n"
+        << "Nodes/second: " << (uint64_t)(seconds > 0.0 ? nodes / seconds : 0.0) << "\n";
+
+   if (!fileName.empty())
+   {
+      ofstream fout(fileName, ios::app);
+      for (const PerftSuite::Result& result : results)
+         fout << result.name << '\t' << result.depth << '\t' << result.nodes << '\t'
+              << result.seconds << '\t' << result.getNPS() << '\t'
+              << (result.passed() ? "pass" : "FAIL") << '\t'
+              << threads << '\t' << megabytes << '\n';
+   }
+
+   return failed;
+}
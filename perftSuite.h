@@ -0,0 +1,76 @@
+/***********************************************************************
+ * Header File:
+ *    PERFT SUITE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The standard perft positions with their published node counts.
+ *    Running them all is the regression test for the move generators,
+ *    and the time each takes is the baseline for their speed
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iostream>
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+class TestPerftSuite;
+
+/***************************************************
+ * PERFT SUITE
+ * Count each known position and compare with the published count
+ ***************************************************/
+class PerftSuite
+{
+   friend TestPerftSuite;
+public:
+   // one known position: nodes[d - 1] is the count at depth d
+   struct Case
+   {
+      const char* name;
+      const char* fen;
+      vector<uint64_t> nodes;
+   };
+
+   // the result of counting one position
+   struct Result
+   {
+      string   name;
+      int      depth;
+      uint64_t nodes;
+      uint64_t expected;
+      double   seconds;
+      bool     passed() const { return nodes == expected; }
+      uint64_t getNPS() const { return seconds > 0.0 ? (uint64_t)(nodes / seconds) : 0; }
+   };
+
+   PerftSuite() : maxNodes(10000000), fast(false), threads(1), megabytes(0) {}
+
+   // each position is counted to the deepest depth within this many nodes
+   void setMaxNodes(uint64_t maxNodes) { this->maxNodes = maxNodes; }
+   void setFast(bool fast)             { this->fast = fast;         }
+   void setThreads(int threads)        { this->threads = threads;   }
+   void setHash(int megabytes)         { this->megabytes = megabytes; }
+
+   // count every position, printing a line as each finishes
+   vector<Result> run(ostream& out) const;
+
+   static const vector<Case>& getCases();
+
+private:
+   Result run(const Case& test) const;
+
+   uint64_t maxNodes;   // the largest count we are willing to wait for
+   bool fast;           // count the last ply with Board::countMoves()
+   int threads;         // more than one uses Perft::countParallel()
+   int megabytes;       // size of the perft hash table, 0 for none
+};
+
+// the "perftsuite [options]" command line mode
+int perftSuiteCommand(int argc, char** argv);
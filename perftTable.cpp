@@ -0,0 +1,84 @@
+/***********************************************************************
+ * Source File:
+ *    PERFT TABLE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    A hash table of perft counts shared by every thread without locks
+ ************************************************************************/
+
+#include "perftTable.h"
+#include "memoryReport.h"
+using namespace std;
+
+/***************************************************
+ * NUM ENTRIES
+ * The largest power of two that fits in the megabytes
+ ***************************************************/
+static size_t numEntries(size_t megabytes, size_t entrySize)
+{
+   size_t num = (megabytes << 20) / entrySize;
+   size_t size = 1;
+   while (size * 2 <= num)
+      size *= 2;
+   return size;
+}
+
+/***************************************************
+ * PERFT TABLE : CONSTRUCTOR
+ * An entry of zeros is empty, so the memory needs no
+ * constructing
+ ***************************************************/
+PerftTable::PerftTable(size_t megabytes) :
+   mask(numEntries(megabytes, sizeof(Entry)) - 1),
+   memory((mask + 1) * sizeof(Entry)),
+   entries((Entry*)memory.get())
+{
+   clear();
+}
+
+/***************************************************
+ * PERFT TABLE : PROBE
+ * The count stored for this position and depth, if there is one
+ ***************************************************/
+bool PerftTable::probe(uint64_t key, int depth, uint64_t& nodes) const
+{
+   const Entry& entry = entries[index(key, depth)];
+   uint64_t data  = entry.data.load(memory_order_relaxed);
+   uint64_t check = entry.check.load(memory_order_relaxed);
+
+   if ((check ^ data) != key || (int)(data & 0xff) != depth)
+      return false;
+
+   nodes = data >> 8;
+   return true;
+}
+
+/***************************************************
+ * PERFT TABLE : STORE
+ * Remember the count, replacing whatever was in the slot
+ ***************************************************/
+void PerftTable::store(uint64_t key, int depth, uint64_t nodes)
+{
+   Entry& entry = entries[index(key, depth)];
+   uint64_t data = (nodes << 8) | (uint64_t)(depth & 0xff);
+   entry.check.store(key ^ data, memory_order_relaxed);
+   entry.data.store(data, memory_order_relaxed);
+}
+
+/***************************************************
+ * PERFT TABLE : CLEAR
+ * Empty every entry. Depth 0 is never probed, so zero is empty
+ ***************************************************/
+void PerftTable::clear()
+{
+   memory.clear();
+}
+
+/***************************************************
+ * PERFT TABLE : MEMORY REPORT
+ ***************************************************/
+void PerftTable::memoryReport(MemoryReport& report) const
+{
+   report.add("Hash", "Perft table entries", getNumEntries(), getBytes() + sizeof(PerftTable));
+}
@@ -0,0 +1,65 @@
+/***********************************************************************
+ * Header File:
+ *    PERFT TABLE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    A hash table of perft counts shared by every thread without locks
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <string>
+#include "hashMemory.h"
+
+class TestPerftTable;
+class MemoryReport;
+
+/***************************************************
+ * PERFT TABLE
+ * Remembers the count below a position at a depth. Each entry is two
+ * words written without a lock, the data and the key XOR the data, so
+ * an entry torn by two threads writing at once fails the key check on
+ * the next probe instead of returning a wrong count.
+ ***************************************************/
+class PerftTable
+{
+   friend TestPerftTable;
+public:
+   PerftTable(size_t megabytes);
+
+   // the count stored for this position and depth, if there is one
+   bool probe(uint64_t key, int depth, uint64_t& nodes) const;
+   void store(uint64_t key, int depth, uint64_t nodes);
+
+   // empty every entry, each thread clearing its share of the pages
+   void clear();
+
+   // how the memory was allocated, for the start of a run
+   std::string describe() const { return memory.describe(); }
+
+   size_t getNumEntries() const { return mask + 1; }
+   size_t getBytes()      const { return getNumEntries() * sizeof(Entry); }
+
+   void memoryReport(MemoryReport& report) const;
+
+private:
+   struct Entry
+   {
+      std::atomic<uint64_t> check;   // key ^ data
+      std::atomic<uint64_t> data;    // nodes << 8 | depth
+   };
+
+   size_t index(uint64_t key, int depth) const
+   {
+      // the same position at another depth goes in another slot
+      return (size_t)(key ^ ((uint64_t)depth * 0x9E3779B97F4A7C15ull)) & mask;
+   }
+
+   size_t mask;                       // number of entries - 1, a power of two
+   HashMemory memory;
+   Entry* entries;
+};
@@ -41,6 +41,7 @@ class TestBoard;
 class Piece
 {
 public:
+   friend Board;
    friend TestPiece;
    friend TestBoard;
    friend TestKing;
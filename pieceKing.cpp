@@ -108,6 +108,11 @@ bool King::canCastleKingSide(const Board& board) const
       if (board[checkPos].getType() != SPACE)
          return false;
    }
+
+   // Can't castle out of check or through an attacked square
+   if (board.isAttacked(position, !isWhite()) ||
+       board.isAttacked(Position(col + 1, row), !isWhite()))
+      return false;
    
    return true;
 }
@@ -142,6 +147,11 @@ bool King::canCastleQueenSide(const Board& board) const
       if (board[checkPos].getType() != SPACE)
          return false;
    }
+
+   // Can't castle out of check or through an attacked square
+   if (board.isAttacked(position, !isWhite()) ||
+       board.isAttacked(Position(col - 1, row), !isWhite()))
+      return false;
    
    return true;
 }
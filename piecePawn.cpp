@@ -41,7 +41,7 @@ void Pawn::getMoves(set <Move>& moves, const Board& board) const
       move.setDest(posOneStep);
       move.setWhiteMove(isWhite());
       move.setCapture(SPACE);
-      moves.insert(move);
+      addMove(moves, move);
 
       // Check if we can move forward by two
       if (nMoves == 0)
@@ -75,7 +75,7 @@ void Pawn::getMoves(set <Move>& moves, const Board& board) const
          move.setDest(posCaptureLeft);
          move.setWhiteMove(isWhite());
          move.setCapture(pieceAtCaptureLeft);
-         moves.insert(move);
+         addMove(moves, move);
       }
    }
 
@@ -91,14 +91,17 @@ void Pawn::getMoves(set <Move>& moves, const Board& board) const
          move.setDest(posCaptureRight);
          move.setWhiteMove(isWhite());
          move.setCapture(pieceAtCaptureRight);
-         moves.insert(move);
+         addMove(moves, move);
       }
    }
 
+   // En passant only happens from our fifth rank, next to a pawn that just moved two
+   bool isFifthRank = position.getRow() == (fWhite ? 4 : 3);
+
    // Check for en passant on the left
    Position posAdjacentLeft(position.getCol() + captureColDeltaLeft, position.getRow()); // Piece left of pawn
    Position posEnPassantLeftTarget(position.getCol() + captureColDeltaLeft, position.getRow() + forwardRowDelta); // The left diagonal square
-   if (posAdjacentLeft.isValid() && board[posAdjacentLeft].getType() == PAWN &&
+   if (isFifthRank && posAdjacentLeft.isValid() && board[posAdjacentLeft].getType() == PAWN &&
       board[posAdjacentLeft].isWhite() != fWhite &&
       board[posAdjacentLeft].getNMoves() == 1 &&
       board[posAdjacentLeft].justMoved(board.getCurrentMove()) &&
@@ -116,7 +119,7 @@ void Pawn::getMoves(set <Move>& moves, const Board& board) const
    // Check for en passant on the right
    Position posAdjacentRight(position.getCol() + captureColDeltaRight, position.getRow()); // Piece right of pawn
    Position posEnPassantRightTarget(position.getCol() + captureColDeltaRight, position.getRow() + forwardRowDelta); // The right diagonal square
-   if (posAdjacentRight.isValid() && board[posAdjacentRight].getType() == PAWN &&
+   if (isFifthRank && posAdjacentRight.isValid() && board[posAdjacentRight].getType() == PAWN &&
       board[posAdjacentRight].isWhite() != fWhite &&
       board[posAdjacentRight].getNMoves() == 1 &&
       board[posAdjacentRight].justMoved(board.getCurrentMove()) &&
@@ -131,3 +134,25 @@ void Pawn::getMoves(set <Move>& moves, const Board& board) const
       moves.insert(move);
    }
 }
+
+/***************************************************
+* PAWN : ADD MOVE
+* Add a move, or one move for each piece we can promote
+* to when it reaches the last rank
+***************************************************/
+void Pawn::addMove(set <Move>& moves, Move& move) const
+{
+   int row = move.getDest().getRow();
+   if (row != 0 && row != 7)
+   {
+      moves.insert(move);
+      return;
+   }
+
+   const PieceType promote[] = { QUEEN, ROOK, BISHOP, KNIGHT };
+   for (PieceType pt : promote)
+   {
+      move.setPromotion(pt);
+      moves.insert(move);
+   }
+}
@@ -0,0 +1,750 @@
+/***********************************************************************
+ * Source File:
+ *    SEARCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The engine: a fail-soft alpha-beta negamax search over the board
+ *    that finds the best move for the side to move and the line of
+ *    play it expects to follow, deepening one ply at a time until the
+ *    depth or the time runs out
+ ************************************************************************/
+
+#include "search.h"
+#include "board.h"
+#include "piece.h"
+#include "trace.h"
+#include "lazySmp.h"
+#include "splitSearch.h"
+#include "moveOrder.h"
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <cstdlib>
+#include <iomanip>
+#include <string>
+using namespace std;
+
+// the value of each piece, indexed by PieceType
+static const int VALUE[8] = { 0, 0, 0, 900, 500, 330, 320, 100 };
+
+// where each piece likes to stand, from white's side of the board with
+// the eighth rank first, so a table reads like the board it describes
+static const int SQUARE[8][64] =
+{
+   { 0 },   // INVALID
+   { 0 },   // SPACE
+   {        // KING
+      -30,-40,-40,-50,-50,-40,-40,-30,
+      -30,-40,-40,-50,-50,-40,-40,-30,
+      -30,-40,-40,-50,-50,-40,-40,-30,
+      -30,-40,-40,-50,-50,-40,-40,-30,
+      -20,-30,-30,-40,-40,-30,-30,-20,
+      -10,-20,-20,-20,-20,-20,-20,-10,
+       20, 20,  0,  0,  0,  0, 20, 20,
+       20, 30, 10,  0,  0, 10, 30, 20
+   },
+   {        // QUEEN
+      -20,-10,-10, -5, -5,-10,-10,-20,
+      -10,  0,  0,  0,  0,  0,  0,-10,
+      -10,  0,  5,  5,  5,  5,  0,-10,
+       -5,  0,  5,  5,  5,  5,  0, -5,
+        0,  0,  5,  5,  5,  5,  0, -5,
+      -10,  5,  5,  5,  5,  5,  0,-10,
+      -10,  0,  5,  0,  0,  0,  0,-10,
+      -20,-10,-10, -5, -5,-10,-10,-20
+   },
+   {        // ROOK
+        0,  0,  0,  0,  0,  0,  0,  0,
+        5, 10, 10, 10, 10, 10, 10,  5,
+       -5,  0,  0,  0,  0,  0,  0, -5,
+       -5,  0,  0,  0,  0,  0,  0, -5,
+       -5,  0,  0,  0,  0,  0,  0, -5,
+       -5,  0,  0,  0,  0,  0,  0, -5,
+       -5,  0,  0,  0,  0,  0,  0, -5,
+        0,  0,  0,  5,  5,  0,  0,  0
+   },
+   {        // BISHOP
+      -20,-10,-10,-10,-10,-10,-10,-20,
+      -10,  0,  0,  0,  0,  0,  0,-10,
+      -10,  0,  5, 10, 10,  5,  0,-10,
+      -10,  5,  5, 10, 10,  5,  5,-10,
+      -10,  0, 10, 10, 10, 10,  0,-10,
+      -10, 10, 10, 10, 10, 10, 10,-10,
+      -10,  5,  0,  0,  0,  0,  5,-10,
+      -20,-10,-10,-10,-10,-10,-10,-20
+   },
+   {        // KNIGHT
+      -50,-40,-30,-30,-30,-30,-40,-50,
+      -40,-20,  0,  0,  0,  0,-20,-40,
+      -30,  0, 10, 15, 15, 10,  0,-30,
+      -30,  5, 15, 20, 20, 15,  5,-30,
+      -30,  0, 15, 20, 20, 15,  0,-30,
+      -30,  5, 10, 15, 15, 10,  5,-30,
+      -40,-20,  0,  5,  5,  0,-20,-40,
+      -50,-40,-30,-30,-30,-30,-40,-50
+   },
+   {        // PAWN
+        0,  0,  0,  0,  0,  0,  0,  0,
+       50, 50, 50, 50, 50, 50, 50, 50,
+       10, 10, 20, 30, 30, 20, 10, 10,
+        5,  5, 10, 25, 25, 10,  5,  5,
+        0,  0,  0, 20, 20,  0,  0,  0,
+        5, -5,-10,  0,  0,-10, -5,  5,
+        5, 10, 10,-20,-20, 10, 10,  5,
+        0,  0,  0,  0,  0,  0,  0,  0
+   }
+};
+
+/***************************************************
+ * SEARCH : CONSTRUCTOR
+ * Every list the search will need, made up front
+ ***************************************************/
+Search::Search(Board& board, TranspositionTable* pTable) :
+   board(board),
+   pTable(pTable),
+   moves(MAX_PLY + 1),
+   scores(MAX_PLY + 1),
+   order(MAX_PLY),
+   pv(MAX_PLY + 1, vector<Move>(MAX_PLY + 1)),
+   line(MAX_PLY + 1),
+   lineLength(0),
+   followPV(false),
+   canStop(false),
+   thread(0),
+   pAbort(nullptr),
+   stopped(false),
+   pStopped(&stopped),
+   pOut(nullptr),
+   nodes(0),
+   score(0),
+   depth(0),
+   pSplitter(nullptr),
+   worker(0),
+   path(MAX_PLY + 1, nullptr)
+{
+   for (vector<Move>& list : moves)
+      list.reserve(256);
+   for (vector<int>& list : scores)
+      list.reserve(256);
+   for (int ply = 0; ply <= MAX_PLY; ply++)
+      pvLength[ply] = 0;
+}
+
+/***************************************************
+ * SKIP SIZE and SKIP PHASE
+ * Which iterations each helper thread skips, so that the
+ * helpers are spread over the depths rather than all
+ * searching the same one at the same time
+ ***************************************************/
+static const int NUM_SKIPS = 20;
+static const int SKIP_SIZE[NUM_SKIPS]  = { 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+static const int SKIP_PHASE[NUM_SKIPS] = { 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7 };
+
+/***************************************************
+ * SEARCH : SEARCH
+ * Iterative deepening. Every iteration but the first may
+ * be cut short by the clock; the first always finishes,
+ * so there is a move to play. A helper may be cut short
+ * at any time, and skips the iterations it was given to
+ ***************************************************/
+int Search::search(int depth, const TimeManager& time)
+{
+   TRACE_SCOPE("Search::search");
+   this->time = time;
+   this->time.start();
+   stopped.store(false, memory_order_relaxed);
+   nodes = 0;
+   score = 0;
+   this->depth = 0;
+   lineLength = 0;
+   if (pTable && pAbort == nullptr)
+      pTable->newSearch();
+   order.newSearch();
+   if (depth > MAX_PLY)
+      depth = MAX_PLY;
+   board.history.reserve(board.history.size() + MAX_PLY + 1);
+
+   for (int iteration = 1; iteration <= depth; iteration++)
+   {
+      if (thread > 0)
+      {
+         int i = (thread - 1) % NUM_SKIPS;
+         if ((iteration + SKIP_PHASE[i]) / SKIP_SIZE[i] % 2 != 0)
+            continue;
+      }
+
+      TRACE_SCOPE("iteration");
+      canStop = this->depth > 0 || thread > 0;
+
+      // a narrow window around the last score, widened until the
+      // score falls inside it
+      int alpha = -INFINITE;
+      int beta = INFINITE;
+      int delta = ASPIRATION;
+      if (this->depth > 0 && iteration >= ASPIRATION_DEPTH && !isMate(score))
+      {
+         alpha = score - delta;
+         beta = score + delta;
+      }
+      int value;
+      do
+      {
+         followPV = true;
+         value = negamax(iteration, 0, alpha, beta);
+      }
+      while (!(stopped.load(memory_order_relaxed) && canStop) && !widen(value, alpha, beta, delta));
+      if (stopped.load(memory_order_relaxed) && canStop)
+         break;
+
+      score = value;
+      this->depth = iteration;
+      lineLength = pvLength[0];
+      copy(pv[0].begin(), pv[0].begin() + lineLength, line.begin());
+      if (pOut)
+         print(*pOut);
+
+      // nothing to search, or no time to finish another iteration
+      if (lineLength == 0 || isMate(score) || !this->time.canDeepen())
+         break;
+   }
+   return score;
+}
+
+/***************************************************
+ * SEARCH : WIDEN
+ * After a search of the root with the window alpha to beta:
+ * true if the score fell inside it. Otherwise the window is
+ * widened past the score on the side it failed, half as much
+ * again each time, and a fail low also brings beta down to
+ * halfway, since the score is likely lower than was thought
+ ***************************************************/
+bool Search::widen(int value, int& alpha, int& beta, int& delta)
+{
+   if (value <= alpha)
+   {
+      beta = (alpha + beta) / 2;
+      alpha = max(value - delta, -INFINITE);
+   }
+   else if (value >= beta)
+      beta = min(value + delta, (int)INFINITE);
+   else
+      return true;
+   delta += delta / 2;
+   return false;
+}
+
+/***************************************************
+ * SEARCH : SET THREAD
+ ***************************************************/
+void Search::setThread(int thread, const atomic<bool>* pAbort)
+{
+   this->thread = thread;
+   this->pAbort = pAbort;
+}
+
+/***************************************************
+ * SEARCH : GET PV
+ ***************************************************/
+vector<Move> Search::getPV() const
+{
+   return vector<Move>(line.begin(), line.begin() + lineLength);
+}
+
+/***************************************************
+ * SEARCH : PRINT
+ * One line for the iteration just finished
+ ***************************************************/
+void Search::print(ostream& out) const
+{
+   printIteration(out, depth, score, pSplitter ? pSplitter->getNodes() : nodes, time.getElapsed(),
+                  pTable, line.data(), lineLength);
+}
+
+/***************************************************
+ * SEARCH : PRINT ITERATION
+ ***************************************************/
+void Search::printIteration(ostream& out, int depth, int score, uint64_t nodes, double ms,
+                            const TranspositionTable* pTable, const Move* pLine, int length)
+{
+   out << "depth " << depth << " score ";
+   if (isMate(score))
+      out << "mate " << (score > 0 ? (MATE - score + 1) / 2 : -(MATE + score) / 2);
+   else
+      out << "cp " << score;
+   out << " nodes " << nodes << " time " << (int)ms;
+   if (pTable)
+      out << " hashfull " << pTable->getHashfull();
+   out << " pv";
+   for (int i = 0; i < length; i++)
+      out << " " << pLine[i].getUCI();
+   out << endl;
+}
+
+/***************************************************
+ * SEARCH : TO TABLE and FROM TABLE
+ * A mate is scored from the root, but the same position can be
+ * reached at another ply. The table holds mates scored from the
+ * position itself
+ ***************************************************/
+int Search::toTable(int score, int ply)
+{
+   if (score >= MATE - MAX_PLY)
+      return score + ply;
+   if (score <= -MATE + MAX_PLY)
+      return score - ply;
+   return score;
+}
+
+int Search::fromTable(int score, int ply)
+{
+   if (score >= MATE - MAX_PLY)
+      return score - ply;
+   if (score <= -MATE + MAX_PLY)
+      return score + ply;
+   return score;
+}
+
+/***************************************************
+ * SEARCH : IS STOPPED
+ * Out of time, or working under a split point that has
+ * failed high, so the scores no longer matter
+ ***************************************************/
+bool Search::isStopped() const
+{
+   return (pStopped->load(memory_order_relaxed) && canStop) ||
+          (pSplitter && pSplitter->isCutoff(worker));
+}
+
+/***************************************************
+ * SEARCH : NEGAMAX
+ * The score of the position for the side to move, searched
+ * depth more plies. Fail-soft: a score outside alpha and beta
+ * is returned as found rather than clamped, so it is still a
+ * bound on the true score. A mate scores by its distance, so
+ * the nearer of two mates is preferred. A table entry deep
+ * enough, with a bound that settles it, answers a node below
+ * the root without searching it. After the first move, the
+ * rest are searched with a null window (principal variation
+ * search), and again with the whole window only if one scores
+ * above alpha. With a splitter attached, the moves left after
+ * any of them may be handed to threads with nothing to do.
+ * Once stopped, the scores are meaningless and every node
+ * returns at once
+ ***************************************************/
+int Search::negamax(int depth, int ply, int alpha, int beta)
+{
+   // look at the clock, and whether the group is done, every 1024 nodes
+   if ((++nodes & 1023) == 0 && canStop &&
+       (time.isOver() || (pAbort && pAbort->load(memory_order_relaxed))))
+      stop();
+   if (isStopped())
+      return 0;
+
+   pvLength[ply] = ply;
+   if (depth <= 0 || ply >= MAX_PLY)
+   {
+      followPV = false;
+      return quiesce(ply, alpha, beta);
+   }
+
+   uint64_t key = 0;
+   uint16_t hashMove = 0;
+   TranspositionTable::Hit hit;
+   if (pTable)
+   {
+      key = board.getHash();
+      if (pTable->probe(key, hit))
+      {
+         hashMove = hit.move;
+         int value = fromTable(hit.score, ply);
+         if (ply > 0 && hit.depth >= depth &&
+             (hit.bound == TranspositionTable::EXACT ||
+              (hit.bound == TranspositionTable::LOWER && value >= beta) ||
+              (hit.bound == TranspositionTable::UPPER && value <= alpha)))
+         {
+            followPV = false;
+            return value;
+         }
+      }
+   }
+
+   vector<Move>& list = moves[ply];
+   board.generateMoves(list);
+   if (list.empty())
+   {
+      followPV = false;
+      return board.inCheck(board.whiteTurn()) ? -MATE + ply : 0;
+   }
+
+   // the last iteration's line first, then the move the table
+   // remembers, then the rest as the tables order them
+   const Move* pPV = nullptr;
+   if (followPV && ply < lineLength)
+      pPV = &line[ply];
+   followPV = order.score(board, list, scores[ply], ply, pPV, hashMove);
+
+   // each helper tries the root moves after the first in its own order
+   if (ply == 0 && thread > 0 && list.size() > 2)
+   {
+      MoveOrder::sort(list, scores[ply], 0);
+      size_t shift = thread % (list.size() - 1);
+      rotate(list.begin() + 1, list.begin() + 1 + shift, list.end());
+      for (size_t i = 0; i < list.size(); i++)
+         scores[ply][i] = (int)(list.size() - i);
+   }
+
+   int alphaStart = alpha;
+   int best = -INFINITE;
+   const Move* pBest = nullptr;
+   for (size_t i = 0; i < list.size(); i++)
+   {
+      MoveOrder::pick(list, scores[ply], i);
+      const Move& move = list[i];
+      path[ply] = &move;
+      // the first move with the whole window. The rest only need to be
+      // shown no better, with a null window, unless one is better
+      board.makeMove(move);
+      int value;
+      if (i == 0)
+         value = -negamax(depth - 1, ply + 1, -beta, -alpha);
+      else
+      {
+         value = -negamax(depth - 1, ply + 1, -alpha - 1, -alpha);
+         if (value > alpha && value < beta && !isStopped())
+            value = -negamax(depth - 1, ply + 1, -beta, -alpha);
+      }
+      board.undoMove();
+      if (isStopped())
+         return 0;
+
+      if (value > best)
+      {
+         best = value;
+         pBest = &move;
+         if (value > alpha)
+         {
+            alpha = value;
+
+            // this move, then the best line below it
+            pv[ply][ply] = move;
+            for (int j = ply + 1; j < pvLength[ply + 1]; j++)
+               pv[ply][j] = pv[ply + 1][j];
+            pvLength[ply] = pvLength[ply + 1];
+
+            if (alpha >= beta)
+            {
+               order.update(board, list, i, ply, depth);
+               break;
+            }
+         }
+      }
+
+      // the elder brother is done: share his younger brothers, which
+      // are put in order first since the split point hands them out
+      // as they stand
+      if (pSplitter && depth >= SplitSearch::MIN_SPLIT_DEPTH && i + 1 < list.size() &&
+          pSplitter->canSplit())
+      {
+         MoveOrder::sort(list, scores[ply], i + 1);
+         pSplitter->split(*this, list, i + 1, depth, ply, alpha, beta, best, pBest);
+         if (isStopped())
+            return 0;
+         if (best >= beta)
+            order.update(board, list, pBest - list.data(), ply, depth);
+         break;
+      }
+   }
+
+   if (pTable)
+   {
+      TranspositionTable::Bound bound = best >= beta        ? TranspositionTable::LOWER :
+                                        best <= alphaStart  ? TranspositionTable::UPPER :
+                                                              TranspositionTable::EXACT;
+      pTable->store(key, TranspositionTable::pack(*pBest), toTable(best, ply), depth, bound);
+   }
+   return best;
+}
+
+/***************************************************
+ * SEARCH : QUIESCE
+ * Past the depth, search only captures and promotions until
+ * the position is quiet, so a leaf is not scored in the middle
+ * of an exchange. The side to move may stand pat on the static
+ * score instead of capturing, and a capture that could not
+ * bring the score up to alpha even with DELTA to spare is not
+ * searched. In check at the first ply past the depth there is
+ * no standing pat: every evasion is searched, and none is mate.
+ * Deeper than that, answering every check costs far more than
+ * it finds, so a check is scored like any other position
+ ***************************************************/
+int Search::quiesce(int ply, int alpha, int beta, bool first)
+{
+   if ((++nodes & 1023) == 0 && canStop &&
+       (time.isOver() || (pAbort && pAbort->load(memory_order_relaxed))))
+      stop();
+   if (isStopped())
+      return 0;
+
+   pvLength[ply] = ply;
+   if (ply >= MAX_PLY)
+      return evaluate(board);
+
+   vector<Move>& list = moves[ply];
+   bool inCheck = first && board.inCheck(board.whiteTurn());
+   int best = -INFINITE;
+   int standPat = 0;
+   if (inCheck)
+   {
+      board.generateMoves(list);
+      if (list.empty())
+         return -MATE + ply;
+   }
+   else
+   {
+      standPat = evaluate(board);
+      if (standPat >= beta)
+         return standPat;
+      if (standPat > alpha)
+         alpha = standPat;
+      best = standPat;
+      board.generateCaptures(list);
+   }
+   MoveOrder::scoreCaptures(board, list, scores[ply]);
+
+   for (size_t i = 0; i < list.size(); i++)
+   {
+      MoveOrder::pick(list, scores[ply], i);
+      const Move& move = list[i];
+
+      // delta pruning: hopeless even if the capture comes for free.
+      // Nor is a capture that loses material in the exchange searched
+      if (!inCheck && (standPat + gain(move) + DELTA <= alpha || !board.seeGE(move, 0)))
+         continue;
+
+      board.makeMove(move);
+      int value = -quiesce(ply + 1, -beta, -alpha, false);
+      board.undoMove();
+      if (isStopped())
+         return 0;
+
+      if (value <= best)
+         continue;
+      best = value;
+      if (value <= alpha)
+         continue;
+      alpha = value;
+      if (alpha >= beta)
+         break;
+   }
+   return best;
+}
+
+/***************************************************
+ * SEARCH : GAIN
+ * The most material a move can win: what it captures, and
+ * what a pawn becomes less the pawn
+ ***************************************************/
+int Search::gain(const Move& move)
+{
+   int value = VALUE[move.getCapture()];
+   if (move.getPromotion() != SPACE && move.getPromotion() != INVALID)
+      value += VALUE[move.getPromotion()] - VALUE[PAWN];
+   return value;
+}
+
+/***************************************************
+ * SEARCH : EVALUATE
+ * Material and where each piece stands, white's total
+ * less black's, from the side to move's point of view
+ ***************************************************/
+int Search::evaluate(const Board& board)
+{
+   int total = 0;
+   for (int c = 0; c < 8; c++)
+      for (int r = 0; r < 8; r++)
+      {
+         const Piece* pPiece = board.board[c][r];
+         if (pPiece == nullptr)
+            continue;
+         PieceType pt = pPiece->getType();
+         if (pt == SPACE)
+            continue;
+         if (pPiece->isWhite())
+            total += VALUE[pt] + SQUARE[pt][(7 - r) * 8 + c];
+         else
+            total -= VALUE[pt] + SQUARE[pt][r * 8 + c];
+      }
+   return board.whiteTurn() ? total : -total;
+}
+
+/***************************************************
+ * SEARCH SCALING
+ * The same search on 1, 2, 4, ... threads, each from an empty
+ * table, compared with one thread: the rate at which nodes are
+ * searched, and the time to reach the depth. Engine is
+ * LazySmp or SplitSearch
+ ***************************************************/
+template <class Engine>
+static void searchScaling(Board& board, TranspositionTable* pTable, int threads, int depth)
+{
+   cout << "Threads  Depth        Nodes     Seconds  Nodes/second  NPS speedup  Time speedup\n";
+   double secondsOne = 0.0;
+   double rateOne = 0.0;
+   for (int n = 1; n <= threads; n = (n * 2 > threads && n < threads) ? threads : n * 2)
+   {
+      if (pTable)
+         pTable->clear();
+      Engine smp(board, pTable, n);
+      auto begin = chrono::steady_clock::now();
+      smp.search(depth);
+      double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+      double rate = seconds > 0.0 ? smp.getNodes() / seconds : 0.0;
+      if (n == 1)
+      {
+         secondsOne = seconds;
+         rateOne = rate;
+      }
+      cout << setw(7) << n << setw(7) << smp.getDepth() << setw(13) << smp.getNodes()
+           << fixed << setprecision(3) << setw(12) << seconds
+           << setw(14) << (uint64_t)rate
+           << setprecision(2) << setw(13) << (rateOne > 0.0 ? rate / rateOne : 0.0)
+           << setw(14) << (seconds > 0.0 ? secondsOne / seconds : 0.0) << "\n";
+   }
+}
+
+/***************************************************
+ * PRINT SPLITS
+ * Only the split search shares out nodes
+ ***************************************************/
+static void printSplits(ostream& out, const LazySmp&)
+{
+   out << "Splits:       none\n";
+}
+
+static void printSplits(ostream& out, const SplitSearch& search)
+{
+   out << "Splits:       " << search.getSplits() << "\n";
+}
+
+/***************************************************
+ * SEARCH RUN
+ * One search on the threads, with its results
+ ***************************************************/
+template <class Engine>
+static void searchRun(Board& board, TranspositionTable* pTable, int threads, int depth,
+                      const TimeManager& timeManager)
+{
+   Engine search(board, pTable, threads);
+   search.setOutput(&cout);
+
+   auto begin = chrono::steady_clock::now();
+   int score = search.search(depth, timeManager);
+   double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+   cout << "Position:     " << board.getFEN() << "\n"
+        << "Depth:        " << search.getDepth() << "\n"
+        << "Threads:      " << search.getThreads() << "\n";
+   printSplits(cout, search);
+   cout << "Best move:    " << (search.hasBestMove() ? search.getBestMove().getUCI() : "none") << "\n"
+        << "Score:        ";
+   if (Search::isMate(score))
+      cout << "mate " << (score > 0 ? (Search::MATE - score + 1) / 2 : -(Search::MATE + score) / 2) << "\n";
+   else
+      cout << "cp " << score << "\n";
+   cout << "PV:          ";
+   for (const Move& move : search.getPV())
+      cout << " " << move.getUCI();
+   cout << "\n"
+        << "Nodes:        " << search.getNodes() << "\n"
+        << "Time:         " << seconds << " s\n"
+        << "Nodes/second: " << (uint64_t)(seconds > 0.0 ? search.getNodes() / seconds : 0.0) << "\n";
+}
+
+/***************************************************
+ * SEARCH COMMAND
+ * Search a position from the command line and print the
+ * best move, the score, the line, and the node count
+ ***************************************************/
+int searchCommand(int argc, char** argv)
+{
+   int depth = 0;
+   int megabytes = 16;
+   int threads = 1;
+   bool scaling = false;
+   bool ybwc = false;
+   int moveTime = 0;
+   int time = 0;
+   int increment = 0;
+   int movesToGo = 0;
+
+   // the FEN has spaces in it, so it may arrive as several arguments
+   string fen;
+   for (int i = 2; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--depth" && i + 1 < argc)
+         depth = atoi(argv[++i]);
+      else if (arg == "--hash" && i + 1 < argc)
+         megabytes = atoi(argv[++i]);
+      else if (arg == "--threads" && i + 1 < argc)
+         threads = atoi(argv[++i]);
+      else if (arg == "--scaling")
+         scaling = true;
+      else if (arg == "--ybwc")
+         ybwc = true;
+      else if (arg == "--movetime" && i + 1 < argc)
+         moveTime = atoi(argv[++i]);
+      else if (arg == "--time" && i + 1 < argc)
+         time = atoi(argv[++i]);
+      else if (arg == "--inc" && i + 1 < argc)
+         increment = atoi(argv[++i]);
+      else if (arg == "--movestogo" && i + 1 < argc)
+         movesToGo = atoi(argv[++i]);
+      else
+         fen += (fen.empty() ? "" : " ") + arg;
+   }
+   if (fen.empty())
+      fen = FEN_INITIAL;
+
+   // a clock without a depth searches as deep as the time allows
+   TimeManager timeManager;
+   if (moveTime > 0)
+      timeManager.setMoveTime(moveTime);
+   else if (time > 0)
+      timeManager.setClock(time, increment, movesToGo);
+   if (depth == 0)
+      depth = timeManager.isLimited() && !scaling ? Search::MAX_PLY : 5;
+   if (depth < 1 || megabytes < 0 || threads < 1 || threads > LazySmp::MAX_THREADS)
+   {
+      cerr << "Usage: " << argv[0] << " search [--depth N] [--hash MB] [--threads N] [--ybwc] [--scaling]"
+           << " [--movetime ms] [--time ms] [--inc ms] [--movestogo N] [FEN]\n";
+      return 1;
+   }
+
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(fen);
+   unique_ptr<TranspositionTable> pTable;
+   if (megabytes > 0)
+      pTable.reset(new TranspositionTable(megabytes));
+   cout << "Hash:         " << (pTable ? pTable->describe() : string("none")) << "\n"
+        << "Mode:         " << (ybwc ? "young brothers wait" : "lazy SMP") << "\n";
+
+   if (scaling)
+   {
+      if (ybwc)
+         searchScaling<SplitSearch>(board, pTable.get(), threads, depth);
+      else
+         searchScaling<LazySmp>(board, pTable.get(), threads, depth);
+      board.free();
+      return 0;
+   }
+
+   if (ybwc)
+      searchRun<SplitSearch>(board, pTable.get(), threads, depth, timeManager);
+   else
+      searchRun<LazySmp>(board, pTable.get(), threads, depth, timeManager);
+
+   board.free();
+   return 0;
+}
@@ -0,0 +1,137 @@
+/***********************************************************************
+ * Header File:
+ *    SEARCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The engine: a fail-soft alpha-beta negamax search over the board
+ *    that finds the best move for the side to move and the line of
+ *    play it expects to follow, deepening one ply at a time until the
+ *    depth or the time runs out
+ ************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <iostream>
+#include "move.h"
+#include "timeManager.h"
+#include "transpositionTable.h"
+#include "moveOrder.h"
+
+using std::vector;
+using std::ostream;
+
+class Board;
+class TestSearch;
+class SplitSearch;
+
+/***************************************************
+ * SEARCH
+ * Searches by making and taking back moves on the one board.
+ * The move lists and principal variation are made once, at
+ * construction, so no node allocates. Each iteration tries the
+ * last one's line first, then the move the table remembers, then
+ * the rest as its MoveOrder scores them, and an iteration cut
+ * short by the clock is thrown away: the results are the last
+ * complete one. A SplitSearch may be attached, to share out the
+ * moves of a node with other threads once the first is searched
+ ***************************************************/
+class Search
+{
+   friend TestSearch;
+   friend SplitSearch;
+public:
+   static const int MAX_PLY  = 64;
+   static const int INFINITE = 32000;
+   static const int MATE     = 31000;    // mate in n plies scores MATE - n
+   static const int DELTA    = 200;      // the margin for delta pruning
+   static const int ASPIRATION       = 15;  // the first half-width of the root window
+   static const int ASPIRATION_DEPTH = 3;   // the first iteration to narrow it
+
+   // the table is optional, and may be shared with other searches
+   Search(Board& board, TranspositionTable* pTable = nullptr);
+
+   // search one ply deeper at a time up to depth plies, or until the
+   // time runs out, and return the score for the side to move
+   int search(int depth, const TimeManager& time = TimeManager());
+
+   // stop the search as soon as it can. Safe from any thread
+   void stop() { pStopped->store(true, std::memory_order_relaxed); }
+
+   // one of a group searching the same position, sharing only the table.
+   // Thread 0 is the main one; the others are helpers that skip some
+   // iterations and order the root moves differently. The group starts
+   // each search of the table and sets abort when it is done
+   void setThread(int thread, const std::atomic<bool>* pAbort);
+
+   // print a line after each iteration, or nothing if null
+   void setOutput(ostream* pOut) { this->pOut = pOut; }
+
+   // the results of the last complete iteration
+   const Move&  getBestMove() const { return line[0];  }
+   vector<Move> getPV()       const;
+   int          getScore()    const { return score;    }
+   int          getDepth()    const { return depth;    }
+   uint64_t     getNodes()    const { return nodes;    }
+   bool         hasBestMove() const { return lineLength > 0; }
+
+   // the static score of a position for the side to move, in centipawns
+   static int evaluate(const Board& board);
+
+   // the most material a capture or promotion can win
+   static int gain(const Move& move);
+
+   // a score that is a forced mate, for either side
+   static bool isMate(int score) { return score >= MATE - MAX_PLY || score <= -MATE + MAX_PLY; }
+
+   // a score as the table keeps it, measured from the position at ply
+   // rather than from the root, and back
+   static int toTable(int score, int ply);
+   static int fromTable(int score, int ply);
+
+   // widen an aspiration window the score fell outside, or return
+   // true if it fell inside
+   static bool widen(int value, int& alpha, int& beta, int& delta);
+
+   // the line printed after each iteration
+   static void printIteration(ostream& out, int depth, int score, uint64_t nodes, double ms,
+                              const TranspositionTable* pTable, const Move* pLine, int length);
+
+private:
+   int negamax(int depth, int ply, int alpha, int beta);
+   int quiesce(int ply, int alpha, int beta, bool first = true);
+   bool isStopped() const;
+   void print(ostream& out) const;
+
+   Board& board;
+   TranspositionTable* pTable;
+   vector<vector<Move>> moves;      // the move list of each ply
+   vector<vector<int>> scores;      // and the order to try them in
+   MoveOrder order;                 // killers, history, and counter-moves
+   vector<vector<Move>> pv;         // pv[ply] is the best line from ply on
+   int pvLength[MAX_PLY + 1];       // pv[ply] runs from ply to pvLength[ply]
+   vector<Move> line;               // the last complete iteration's line
+   int lineLength;
+   bool followPV;                   // still on the line, so try it first
+   bool canStop;                    // this iteration may be cut short
+   int thread;                      // 0 unless a helper
+   const std::atomic<bool>* pAbort; // the group is done, if in one
+   TimeManager time;
+   std::atomic<bool> stopped;
+   std::atomic<bool>* pStopped;     // stopped, or that of the search this one helps
+   ostream* pOut;
+   uint64_t nodes;                  // positions visited by the last search
+   int score;
+   int depth;                       // of the last complete iteration
+   SplitSearch* pSplitter;          // shares out the moves of a node, if any
+   int worker;                      // this search's thread in the splitter
+   vector<const Move*> path;        // the move being searched at each ply
+};
+
+// the "search [--depth N] [--hash MB] [--threads N] [--ybwc] [--scaling]
+// [--movetime ms] [--time ms] [--inc ms] [--movestogo N] [FEN]"
+// command line mode
+int searchCommand(int argc, char** argv);
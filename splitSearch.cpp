@@ -0,0 +1,308 @@
+/***********************************************************************
+ * Source File:
+ *    SPLIT SEARCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Search on several threads by sharing out the moves of a node:
+ *    Young Brothers Wait. Once the first move of a node has been
+ *    searched, its brothers may be searched at the same time by any
+ *    thread that has nothing to do
+ ************************************************************************/
+
+#include "splitSearch.h"
+#include "board.h"
+#include "trace.h"
+#include <string>
+using namespace std;
+
+/***************************************************
+ * SPLIT POINT : PICK
+ * Hand out the moves one at a time, with the best alpha
+ * found so far, until they run out or one fails high
+ ***************************************************/
+bool SplitSearch::SplitPoint::pick(const Move*& pMove, int& alpha)
+{
+   lock_guard<std::mutex> lock(mutex);
+   if (cutoff.load(memory_order_relaxed) || next >= pList->size())
+      return false;
+   pMove = &(*pList)[next++];
+   alpha = this->alpha;
+   return true;
+}
+
+/***************************************************
+ * SPLIT SEARCH : CONSTRUCTOR
+ * The main thread's Search is made here, and the helpers
+ * start waiting for split points
+ ***************************************************/
+SplitSearch::SplitSearch(Board& board, TranspositionTable* pTable, int threads) :
+   board(board),
+   pTable(pTable),
+   numIdle(0),
+   quitting(false),
+   splits(0)
+{
+   threads = threads < 1 ? 1 : (threads > MAX_THREADS ? MAX_THREADS : threads);
+   for (int i = 0; i < threads; i++)
+   {
+      unique_ptr<Worker> pWorker(new Worker);
+      Worker& w = *pWorker;
+      w.id = i;
+      w.splits.reset(new SplitPoint[Search::MAX_PLY + 1]);
+      for (int ply = 0; ply <= Search::MAX_PLY; ply++)
+         w.splits[ply].pv.resize(Search::MAX_PLY + 1);
+      w.pSplit = nullptr;
+      w.pAssigned = nullptr;
+      w.idle = i > 0;
+      workers.push_back(move(pWorker));
+   }
+   attach(*workers[0], new Search(board, pTable));
+
+   numIdle = threads - 1;
+   for (int i = 1; i < threads; i++)
+   {
+      Worker* pWorker = workers[i].get();
+      pWorker->thread = thread([this, pWorker]() { idle(*pWorker); });
+   }
+}
+
+/***************************************************
+ * SPLIT SEARCH : DESTRUCTOR
+ ***************************************************/
+SplitSearch::~SplitSearch()
+{
+   {
+      lock_guard<std::mutex> lock(mutex);
+      quitting = true;
+   }
+   cvWork.notify_all();
+   for (unique_ptr<Worker>& pWorker : workers)
+   {
+      if (pWorker->thread.joinable())
+         pWorker->thread.join();
+      pWorker->pSearch.reset();
+      if (pWorker->pCopy)
+         pWorker->pCopy->free();
+   }
+}
+
+/***************************************************
+ * SPLIT SEARCH : ATTACH
+ * A thread searches with this Search, which shares out
+ * its nodes here and stops when the main one does
+ ***************************************************/
+void SplitSearch::attach(Worker& w, Search* pSearch)
+{
+   w.pSearch.reset(pSearch);
+   pSearch->pSplitter = this;
+   pSearch->worker = w.id;
+   if (w.id > 0)
+      pSearch->pStopped = &mainSearch().stopped;
+}
+
+/***************************************************
+ * SPLIT SEARCH : SEARCH
+ * The main thread's Search does the iterative deepening.
+ * The helpers are all idle between searches, so their
+ * boards and Searches are replaced with ones on this
+ * position then
+ ***************************************************/
+int SplitSearch::search(int depth, const TimeManager& time)
+{
+   TRACE_SCOPE("SplitSearch::search");
+   splits = 0;
+   {
+      lock_guard<std::mutex> lock(mutex);
+      for (size_t i = 1; i < workers.size(); i++)
+      {
+         Worker& w = *workers[i];
+         w.pSearch.reset();
+         if (w.pCopy)
+            w.pCopy->free();
+         w.pCopy.reset(new Board(board));
+         w.pCopy->history.reserve(Search::MAX_PLY + 1);
+         attach(w, new Search(*w.pCopy, pTable));
+      }
+   }
+   return mainSearch().search(depth, time);
+}
+
+/***************************************************
+ * SPLIT SEARCH : GET NODES
+ ***************************************************/
+uint64_t SplitSearch::getNodes() const
+{
+   uint64_t nodes = 0;
+   for (const unique_ptr<Worker>& pWorker : workers)
+      if (pWorker->pSearch)
+         nodes += pWorker->pSearch->getNodes();
+   return nodes;
+}
+
+/***************************************************
+ * SPLIT SEARCH : IS CUTOFF
+ * A split point this thread is working under has failed
+ * high. Only the thread itself walks its chain
+ ***************************************************/
+bool SplitSearch::isCutoff(int worker) const
+{
+   for (const SplitPoint* pSplit = workers[worker]->pSplit; pSplit; pSplit = pSplit->pParent)
+      if (pSplit->cutoff.load(memory_order_relaxed))
+         return true;
+   return false;
+}
+
+/***************************************************
+ * SPLIT SEARCH : SPLIT
+ * Make a split point of the moves from first on, give it
+ * to every idle helper, search it, and wait for them.
+ * Then the node carries on with what they found
+ ***************************************************/
+void SplitSearch::split(Search& search, const vector<Move>& list, size_t first, int depth, int ply,
+                        int& alpha, int beta, int& best, const Move*& pBest)
+{
+   Worker& w = *workers[search.worker];
+   SplitPoint& sp = w.splits[ply];
+   sp.pParent = w.pSplit;
+   sp.pOwner = &w;
+   sp.ply = ply;
+   sp.depth = depth;
+   sp.beta = beta;
+   sp.pList = &list;
+   sp.next = first;
+   sp.alpha = alpha;
+   sp.best = best;
+   sp.pBest = pBest;
+   sp.pvLength = 0;
+   sp.cutoff.store(false, memory_order_relaxed);
+
+   // each helper watches the same clock, so any thread may stop them all
+   int helpers = 0;
+   {
+      lock_guard<std::mutex> lock(mutex);
+      for (unique_ptr<Worker>& pWorker : workers)
+         if (pWorker->idle)
+         {
+            pWorker->idle = false;
+            pWorker->pAssigned = &sp;
+            pWorker->pSearch->time = search.time;
+            pWorker->pSearch->canStop = search.canStop;
+            helpers++;
+            numIdle--;
+         }
+      sp.workers = 1 + helpers;
+   }
+   if (helpers > 0)
+   {
+      splits++;
+      cvWork.notify_all();
+   }
+
+   searchSplit(w, sp);
+
+   {
+      unique_lock<std::mutex> lock(mutex);
+      sp.workers--;
+      cvDone.wait(lock, [&sp]() { return sp.workers == 0; });
+   }
+
+   best = sp.best;
+   pBest = sp.pBest;
+   alpha = sp.alpha;
+   if (sp.pvLength > 0)
+   {
+      for (int j = ply; j < sp.pvLength; j++)
+         search.pv[ply][j] = sp.pv[j];
+      search.pvLength[ply] = sp.pvLength;
+   }
+}
+
+/***************************************************
+ * SPLIT SEARCH : SEARCH SPLIT
+ * Take moves from the split point until there are none
+ * left, searching each with the thread's own Search and
+ * reporting its score back
+ ***************************************************/
+void SplitSearch::searchSplit(Worker& w, SplitPoint& sp)
+{
+   Search& search = *w.pSearch;
+   Board& board = search.board;
+   SplitPoint* pPrevious = w.pSplit;
+   w.pSplit = &sp;
+
+   const Move* pMove = nullptr;
+   int alpha = 0;
+   while (!search.isStopped() && sp.pick(pMove, alpha))
+   {
+      search.path[sp.ply] = pMove;
+      board.makeMove(*pMove);
+      // a null window, as the first move has been searched already
+      int value = -search.negamax(sp.depth - 1, sp.ply + 1, -alpha - 1, -alpha);
+      if (value > alpha && value < sp.beta && !search.isStopped())
+         value = -search.negamax(sp.depth - 1, sp.ply + 1, -sp.beta, -alpha);
+      board.undoMove();
+      if (search.isStopped())
+         break;
+
+      lock_guard<std::mutex> lock(sp.mutex);
+      if (value <= sp.best)
+         continue;
+      sp.best = value;
+      sp.pBest = pMove;
+      if (value <= sp.alpha)
+         continue;
+      sp.alpha = value;
+      sp.pv[sp.ply] = *pMove;
+      for (int j = sp.ply + 1; j < search.pvLength[sp.ply + 1]; j++)
+         sp.pv[j] = search.pv[sp.ply + 1][j];
+      sp.pvLength = search.pvLength[sp.ply + 1];
+      if (value >= sp.beta)
+         sp.cutoff.store(true, memory_order_relaxed);
+   }
+
+   w.pSplit = pPrevious;
+}
+
+/***************************************************
+ * SPLIT SEARCH : IDLE
+ * A helper's life: wait for a split point, play the owner's
+ * moves from the root to reach it, search it, take the
+ * moves back, and wait again
+ ***************************************************/
+void SplitSearch::idle(Worker& w)
+{
+   string name = "split helper " + to_string(w.id);
+   Trace::setThreadName(name.c_str());
+
+   unique_lock<std::mutex> lock(mutex);
+   while (true)
+   {
+      cvWork.wait(lock, [this, &w]() { return quitting || w.pAssigned != nullptr; });
+      if (quitting)
+         return;
+      SplitPoint& sp = *w.pAssigned;
+      w.pAssigned = nullptr;
+      lock.unlock();
+
+      {
+         TRACE_SCOPE("split point");
+         Search& search = *w.pSearch;
+         const Search& owner = *sp.pOwner->pSearch;
+         for (int i = 0; i < sp.ply; i++)
+         {
+            search.path[i] = owner.path[i];
+            search.board.makeMove(*search.path[i]);
+         }
+         searchSplit(w, sp);
+         for (int i = 0; i < sp.ply; i++)
+            search.board.undoMove();
+      }
+
+      lock.lock();
+      sp.workers--;
+      w.idle = true;
+      numIdle++;
+      cvDone.notify_all();
+   }
+}
@@ -0,0 +1,152 @@
+/***********************************************************************
+ * Header File:
+ *    SPLIT SEARCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    Search on several threads by sharing out the moves of a node:
+ *    Young Brothers Wait. Once the first move of a node has been
+ *    searched, its brothers may be searched at the same time by any
+ *    thread that has nothing to do
+ ************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include "search.h"
+
+using std::vector;
+using std::unique_ptr;
+using std::ostream;
+
+class Board;
+class TestSplitSearch;
+
+/***************************************************
+ * SPLIT SEARCH
+ * The main thread searches on the caller's board; the helpers wait
+ * with Searches on copies of it. Every thread's Search is attached
+ * to this, so a node with enough depth left whose first move is
+ * done becomes a split point when a helper is idle: the helpers play
+ * the moves from the root to it on their own boards and take its
+ * remaining moves one at a time from its picker. The thread that
+ * made the split point searches them too, then waits for the rest.
+ * A cutoff at a split point stops every thread below it. Unlike
+ * Lazy SMP the threads do not search the same nodes twice, so the
+ * node count stays close to one thread's
+ ***************************************************/
+class SplitSearch
+{
+   friend TestSplitSearch;
+   friend Search;
+public:
+   static const int MAX_THREADS = 64;
+
+   // plies left below a node for it to be worth sharing
+   static const int MIN_SPLIT_DEPTH = 3;
+
+   SplitSearch(Board& board, TranspositionTable* pTable, int threads = 1);
+   ~SplitSearch();
+   SplitSearch(const SplitSearch&) = delete;
+   SplitSearch& operator = (const SplitSearch&) = delete;
+
+   // search one ply deeper at a time up to depth plies, or until the
+   // time runs out, and return the score for the side to move
+   int search(int depth, const TimeManager& time = TimeManager());
+
+   // stop the search as soon as it can. Safe from any thread
+   void stop() { mainSearch().stop(); }
+
+   // print a line after each iteration, or nothing if null
+   void setOutput(ostream* pOut) { mainSearch().setOutput(pOut); }
+
+   // the results of the last complete iteration
+   const Move&  getBestMove() const { return mainSearch().getBestMove(); }
+   vector<Move> getPV()       const { return mainSearch().getPV();       }
+   int          getScore()    const { return mainSearch().getScore();    }
+   int          getDepth()    const { return mainSearch().getDepth();    }
+   bool         hasBestMove() const { return mainSearch().hasBestMove(); }
+
+   // positions visited by every thread together
+   uint64_t getNodes()   const;
+   int      getThreads() const { return (int)workers.size(); }
+
+   // split points made by the last search
+   uint64_t getSplits()  const { return splits; }
+
+private:
+   struct Worker;
+
+   /***************************************************
+    * SPLIT POINT
+    * A node whose remaining moves are shared. The picker
+    * and the results are guarded by its mutex
+    ***************************************************/
+   struct SplitPoint
+   {
+      SplitPoint* pParent;           // the one its owner was working in
+      Worker* pOwner;
+      int ply;
+      int depth;
+      int beta;
+      const vector<Move>* pList;     // the owner's move list at the node
+      size_t next;                   // the next move to hand out
+      int alpha;
+      int best;
+      const Move* pBest;
+      vector<Move> pv;               // the best line from ply on
+      int pvLength;
+      int workers;                   // threads still on it, under the search's mutex
+      std::atomic<bool> cutoff;      // a move failed high: stop its threads
+      std::mutex mutex;
+
+      // the next move and the alpha to search it with, if there is one
+      bool pick(const Move*& pMove, int& alpha);
+   };
+
+   /***************************************************
+    * WORKER
+    * One thread, and the Search it searches with
+    ***************************************************/
+   struct Worker
+   {
+      int id;                        // 0 for the main thread
+      unique_ptr<Board> pCopy;       // a helper's own board
+      unique_ptr<Search> pSearch;    // on the caller's board, or the copy
+      unique_ptr<SplitPoint[]> splits;  // the one it may make at each ply
+      SplitPoint* pSplit;            // the one it is working in, if any
+      SplitPoint* pAssigned;         // handed to it while idle
+      bool idle;
+      std::thread thread;
+   };
+
+   Search&       mainSearch()       { return *workers[0]->pSearch; }
+   const Search& mainSearch() const { return *workers[0]->pSearch; }
+
+   // the hooks Search::negamax calls
+   bool canSplit() const { return numIdle.load(std::memory_order_relaxed) > 0; }
+   void split(Search& search, const vector<Move>& list, size_t first, int depth, int ply,
+              int& alpha, int beta, int& best, const Move*& pBest);
+   bool isCutoff(int worker) const;
+
+   void attach(Worker& w, Search* pSearch);
+   void searchSplit(Worker& w, SplitPoint& sp);
+   void idle(Worker& w);
+
+   Board& board;
+   TranspositionTable* pTable;
+   vector<unique_ptr<Worker>> workers;
+   std::mutex mutex;                  // guards idle, pAssigned, and workers
+   std::condition_variable cvWork;    // a helper was given a split point
+   std::condition_variable cvDone;    // a helper left a split point
+   std::atomic<int> numIdle;
+   bool quitting;
+   std::atomic<uint64_t> splits;
+};
@@ -19,6 +19,34 @@
 #include "testPawn.h"
 #include "testBishop.h"
 #include "testQueen.h"
+#include "testPerft.h"
+#include "testThreadPool.h"
+#include "testPerftTable.h"
+#include "testPerftSuite.h"
+#include "testMicroBench.h"
+#include "testAllocScope.h"
+#include "testBenchReport.h"
+#include "testPerfCounters.h"
+#include "testDiffTest.h"
+#include "testBench.h"
+#include "testTrace.h"
+#include "testMemoryReport.h"
+#include "testSearch.h"
+#include "testTimeManager.h"
+#include "testTranspositionTable.h"
+#include "testHashMemory.h"
+#include "testLazySmp.h"
+#include "testSplitSearch.h"
+#include "testMoveOrder.h"
+#include "threadPool.h"
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <cstdlib>
 
 // This code, and the similar IF_DEF in testRunner(), is to ensure that
 // you can see the text output (called the console window) and OpenGL's
@@ -28,9 +56,8 @@
 // these two "#ifdef _WIN32" and the "#endif" below it.
 #ifdef _WIN32
 #include <windows.h>
-#include <iostream>
-using namespace std;
 #endif
+using namespace std;
 
 
 int PieceSpy::numConstruct = 0;
@@ -39,11 +66,102 @@ int PieceSpy::numDelete = 0;
 int PieceSpy::numAssign = 0;
 int PieceSpy::numMove = 0;
 
+/*****************************************************************
+ * OUTCOME
+ * What one suite printed, how it did, and how long each case took
+ ****************************************************************/
+struct Outcome
+{
+   ostringstream out;
+   int numTests = 0;
+   int numFailed = 0;
+   vector<UnitTest::Timing> timings;
+};
+
+/*****************************************************************
+ * SUITE
+ * One test class, by the name it reports under
+ ****************************************************************/
+struct Suite
+{
+   const char* name;
+   function<void(const vector<string>& cases, Outcome& outcome)> run;
+};
+
+template <class T>
+static Suite suite(const char* name)
+{
+   return { name, [](const vector<string>& cases, Outcome& outcome)
+   {
+      T test;
+      test.setOutput(outcome.out);
+      test.setFilter(cases);
+      test.run();
+      outcome.numTests = test.getNumTests();
+      outcome.numFailed = test.getNumFailed();
+      outcome.timings = test.getTimings();
+   } };
+}
+
+/*****************************************************************
+ * SELECT CASES
+ * Which cases of a suite the filters pick. Each filter is a
+ * suite name, SUITE.CASE, or part of a case name in any suite.
+ * False when the suite is not wanted at all; an empty list of
+ * cases means every one
+ ****************************************************************/
+static bool selectCases(const string& name, const vector<string>& filters,
+                        const vector<Suite>& suites, vector<string>& cases)
+{
+   cases.clear();
+   if (filters.empty())
+      return true;
+
+   bool selected = false;
+   bool all = false;
+   for (const string& filter : filters)
+   {
+      size_t dot = filter.find('.');
+      bool isSuite = false;
+      for (const Suite& suite : suites)
+         isSuite = isSuite || filter == suite.name;
+
+      if (dot != string::npos)
+      {
+         if (filter.substr(0, dot) != name)
+            continue;
+         selected = true;
+         if (dot + 1 == filter.size())
+            all = true;
+         else
+            cases.push_back(filter.substr(dot + 1));
+      }
+      else if (isSuite)
+      {
+         if (filter == name)
+            selected = all = true;
+      }
+      else
+      {
+         selected = true;
+         cases.push_back(filter);
+      }
+   }
+   if (all)
+      cases.clear();
+   return selected;
+}
+
 /*****************************************************************
  * TEST RUNNER
- * Runs all the unit tests
+ * Runs the unit tests. The suites run at the same time on a pool
+ * of threads, each into its own buffer, which are then printed in
+ * order. The slowest cases are listed after them, and each case's
+ * time can be written to a file of JSON records.
+ * Returns the number of test cases that failed
  ****************************************************************/
-void testRunner()
+int testRunner(const vector<string>& filters, int threads, int slowest,
+               const string& fileJson)
 {
 #ifdef _WIN32
    AllocConsole();
@@ -53,15 +171,139 @@ void testRunner()
 #endif // _WIN32
 
    // unit tests
-   PositionTest().run();
-   TestMove().run();
-   TestBoard().run();
-   TestPiece().run();
-   TestSpace().run();
-   TestKnight().run();
-   TestRook().run();
-   TestBishop().run();
-   TestQueen().run();
-   TestKing().run();
-   TestPawn().run();
+   const vector<Suite> suites =
+   {
+      suite<PositionTest>    ("Position"),
+      suite<TestMove>        ("Move"),
+      suite<TestBoard>       ("Board"),
+      suite<TestPiece>       ("Piece"),
+      suite<TestSpace>       ("Space"),
+      suite<TestKnight>      ("Knight"),
+      suite<TestRook>        ("Rook"),
+      suite<TestBishop>      ("Bishop"),
+      suite<TestQueen>       ("Queen"),
+      suite<TestKing>        ("King"),
+      suite<TestPawn>        ("Pawn"),
+      suite<TestPerft>       ("Perft"),
+      suite<TestThreadPool>  ("ThreadPool"),
+      suite<TestPerftTable>  ("PerftTable"),
+      suite<TestPerftSuite>  ("PerftSuite"),
+      suite<TestMicroBench>  ("MicroBench"),
+      suite<TestAllocScope>  ("AllocScope"),
+      suite<TestBenchReport> ("BenchReport"),
+      suite<TestPerfCounters>("PerfCounters"),
+      suite<TestDiffTest>    ("DiffTest"),
+      suite<TestBench>       ("Bench"),
+      suite<TestTrace>       ("Trace"),
+      suite<TestMemoryReport>("MemoryReport"),
+      suite<TestSearch>      ("Search"),
+      suite<TestTimeManager> ("TimeManager"),
+      suite<TestTranspositionTable>("TranspositionTable"),
+      suite<TestHashMemory>  ("HashMemory"),
+      suite<TestLazySmp>     ("LazySmp"),
+      suite<TestSplitSearch> ("SplitSearch"),
+      suite<TestMoveOrder>   ("MoveOrder"),
+   };
+
+   vector<Outcome> outcomes(suites.size());
+   auto begin = chrono::steady_clock::now();
+   {
+      ThreadPool pool(threads);
+      for (size_t i = 0; i < suites.size(); i++)
+      {
+         vector<string> cases;
+         if (!selectCases(suites[i].name, filters, suites, cases))
+            continue;
+         pool.submit([&, i, cases](int)
+         {
+            suites[i].run(cases, outcomes[i]);
+         });
+      }
+      pool.wait();
+   }
+   double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+   // every case as SUITE.CASE, with the sum of their times
+   int total = 0;
+   int failed = 0;
+   double secondsTests = 0.0;
+   vector<UnitTest::Timing> timings;
+   for (size_t i = 0; i < suites.size(); i++)
+   {
+      cout << outcomes[i].out.str();
+      total += outcomes[i].numTests;
+      failed += outcomes[i].numFailed;
+      for (const UnitTest::Timing& timing : outcomes[i].timings)
+      {
+         timings.push_back({ string(suites[i].name) + "." + timing.name, timing.seconds });
+         secondsTests += timing.seconds;
+      }
+   }
+
+   if (!fileJson.empty())
+   {
+      ofstream fout(fileJson);
+      for (const UnitTest::Timing& timing : timings)
+      {
+         size_t dot = timing.name.find('.');
+         fout << "{\"suite\": \"" << timing.name.substr(0, dot)
+              << "\", \"case\": \"" << timing.name.substr(dot + 1)
+              << "\", \"time_ms\": " << setprecision(6) << timing.seconds * 1000.0 << "}\n";
+      }
+   }
+
+   // the slowest cases first. The stable sort keeps ties in the order they ran
+   stable_sort(timings.begin(), timings.end(),
+               [](const UnitTest::Timing& lhs, const UnitTest::Timing& rhs)
+               { return lhs.seconds > rhs.seconds; });
+   if (slowest > 0 && !timings.empty())
+   {
+      cout << "\nSlowest tests:\n";
+      for (int i = 0; i < slowest && i < (int)timings.size(); i++)
+         cout << fixed << setprecision(2) << setw(11) << timings[i].seconds * 1000.0
+              << " ms  " << timings[i].name << "\n";
+      cout.unsetf(ios::fixed);
+      cout.precision(6);
+   }
+
+   cout << "\nTests:        " << total << "\n"
+        << "Failed:       " << failed << "\n"
+        << "Threads:      " << threads << "\n"
+        << "Test time:    " << secondsTests << " s\n"
+        << "Time:         " << seconds << " s\n";
+   return failed;
+}
+
+/*****************************************************************
+ * TEST COMMAND
+ * The "test [--threads N] [--slowest N] [--json file] [filter ...]"
+ * command line mode
+ ****************************************************************/
+int testCommand(int argc, char** argv)
+{
+   vector<string> filters;
+   int threads = (int)thread::hardware_concurrency();
+   int slowest = 10;
+   string fileJson;
+   for (int i = 2; i < argc; i++)
+   {
+      string arg(argv[i]);
+      if (arg == "--threads" && i + 1 < argc)
+         threads = atoi(argv[++i]);
+      else if (arg == "--slowest" && i + 1 < argc)
+         slowest = atoi(argv[++i]);
+      else if (arg == "--json" && i + 1 < argc)
+         fileJson = argv[++i];
+      else if (!arg.empty() && arg[0] == '-')
+      {
+         cerr << "Usage: " << argv[0] << " test [--threads N] [--slowest N] [--json file] "
+              << "[SUITE | SUITE.CASE | CASE ...]\n";
+         return 1;
+      }
+      else
+         filters.push_back(arg);
+   }
+   if (threads < 1)
+      threads = 1;
+   return testRunner(filters, threads, slowest, fileJson);
 }
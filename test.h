@@ -9,4 +9,15 @@
 
 #pragma once
 
-void testRunner();
+#include <string>
+#include <vector>
+
+// run the unit tests that match the filters, every one if there are
+// none, on this many threads. List the slowest cases, and write each
+// case's time to the JSON file if there is one. Returns the number
+// that failed
+int testRunner(const std::vector<std::string>& filters, int threads,
+               int slowest = 10, const std::string& fileJson = "");
+
+// the "test [--threads N] [--slowest N] [--json file] [filter ...]" command line mode
+int testCommand(int argc, char** argv);
@@ -0,0 +1,319 @@
+/***********************************************************************
+ * Source File:
+ *    TEST ALLOC SCOPE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for AllocScope, and the allocations of the hot
+ *    paths that it measures
+ ************************************************************************/
+
+#include "testAllocScope.h"
+#include "allocScope.h"
+#include "board.h"
+#include "piece.h"
+#include <set>
+#include <vector>
+using namespace std;
+
+// the compiler may not remove an allocation whose pointer escapes here
+static void* volatile pEscape = nullptr;
+
+/***************************************************
+ * FIND MOVE
+ * The legal move with the given coordinates, such as "e4d5"
+ ***************************************************/
+static Move findMove(Board& board, const string& uci)
+{
+   vector<Move> moves;
+   board.getMoves(moves);
+   for (const Move& move : moves)
+      if (move.getUCI() == uci)
+         return move;
+   return Move();
+}
+
+/*************************************
+ * CONSTRUCT empty
+ * Input : nothing allocated
+ * Output: all counts zero
+ **************************************/
+void TestAllocScope::construct_empty()
+{
+   // EXERCISE
+   AllocScope scope("empty");
+   size_t allocations = scope.getAllocations();
+   size_t bytes = scope.getBytes();
+   size_t frees = scope.getFrees();
+
+   // VERIFY
+   assertUnit(string(scope.getName()) == "empty");
+   assertUnit(allocations == 0);
+   assertUnit(bytes == 0);
+   assertUnit(frees == 0);
+}
+
+/*************************************
+ * COUNT new and delete
+ * Input : one double allocated and freed
+ * Output: one allocation of sizeof(double) and one free
+ **************************************/
+void TestAllocScope::count_newDelete()
+{
+   // SETUP
+   AllocScope scope;
+
+   // EXERCISE
+   double* p = new double(3.14);
+   pEscape = p;
+   delete p;
+   size_t allocations = scope.getAllocations();
+   size_t bytes = scope.getBytes();
+   size_t frees = scope.getFrees();
+
+   // VERIFY
+   assertUnit(allocations == 1);
+   assertUnit(bytes == sizeof(double));
+   assertUnit(frees == 1);
+}
+
+/*************************************
+ * COUNT array
+ * Input : an array of 100 ints allocated and freed
+ * Output: one allocation of at least 400 bytes and one free
+ **************************************/
+void TestAllocScope::count_array()
+{
+   // SETUP
+   AllocScope scope;
+
+   // EXERCISE
+   int* p = new int[100];
+   pEscape = p;
+   delete [] p;
+   size_t allocations = scope.getAllocations();
+   size_t bytes = scope.getBytes();
+   size_t frees = scope.getFrees();
+
+   // VERIFY
+   assertUnit(allocations == 1);
+   assertUnit(bytes >= 100 * sizeof(int));
+   assertUnit(frees == 1);
+}
+
+/*************************************
+ * COUNT nested
+ * Input : one allocation in the outer scope, two in the inner
+ * Output: the inner sees two, the outer all three
+ **************************************/
+void TestAllocScope::count_nested()
+{
+   // SETUP
+   AllocScope outer("outer");
+   char* p1 = new char;
+   pEscape = p1;
+
+   // EXERCISE
+   size_t inner;
+   {
+      AllocScope scope("inner");
+      char* p2 = new char;
+      pEscape = p2;
+      char* p3 = new char;
+      pEscape = p3;
+      delete p2;
+      delete p3;
+      inner = scope.getAllocations();
+   }
+   delete p1;
+   size_t allocations = outer.getAllocations();
+   size_t frees = outer.getFrees();
+
+   // VERIFY
+   assertUnit(inner == 2);
+   assertUnit(allocations == 3);
+   assertUnit(frees == 3);
+}
+
+/*************************************
+ * COUNT after close
+ * Input : an allocation after the inner scope closed
+ * Output: counted only in the scope still open
+ **************************************/
+void TestAllocScope::count_afterClose()
+{
+   // SETUP
+   AllocScope outer;
+   {
+      AllocScope inner;
+   }
+
+   // EXERCISE
+   char* p = new char;
+   pEscape = p;
+   delete p;
+   size_t allocations = outer.getAllocations();
+   size_t frees = outer.getFrees();
+
+   // VERIFY
+   assertUnit(allocations == 1);
+   assertUnit(frees == 1);
+}
+
+/*************************************
+ * RESET zero
+ * Input : a scope that has counted an allocation
+ * Output: counts are zero again
+ **************************************/
+void TestAllocScope::reset_zero()
+{
+   // SETUP
+   AllocScope scope;
+   char* p = new char;
+   pEscape = p;
+   delete p;
+
+   // EXERCISE
+   scope.reset();
+   size_t allocations = scope.getAllocations();
+   size_t bytes = scope.getBytes();
+   size_t frees = scope.getFrees();
+
+   // VERIFY
+   assertUnit(allocations == 0);
+   assertUnit(bytes == 0);
+   assertUnit(frees == 0);
+}
+
+/*************************************
+ * BOARD MOVE capture when warm
+ * Input : e4xd5, after the board has made and taken back a
+ *         capture once so its history and spare pieces are ready
+ * Output: no allocations, one free (the captured pawn)
+ **************************************/
+void TestAllocScope::boardMove_captureWarm()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4k3/8/8/3p4/4P3/8/8/4K3 w - - 0 1");
+   Move e4d5 = findMove(board, "e4d5");
+   board.makeMove(e4d5);
+   board.undoMove();
+
+   // EXERCISE
+   size_t allocations;
+   size_t frees;
+   {
+      AllocScope scope;
+      board.move(e4d5);
+      allocations = scope.getAllocations();
+      frees = scope.getFrees();
+   }
+
+   // VERIFY
+   assertUnit(e4d5.getCapture() == PAWN);
+   assertUnit(allocations == 0);
+   assertUnit(frees == 1);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * BOARD MAKE and UNDO when warm
+ * Input : every legal move of the initial position made and
+ *         taken back, the second time around
+ * Output: nothing allocated or freed
+ **************************************/
+void TestAllocScope::boardMakeUndo_warm()
+{
+   // SETUP
+   Board board;
+   vector<Move> moves;
+   board.getMoves(moves);
+   for (const Move& move : moves)
+   {
+      board.makeMove(move);
+      board.undoMove();
+   }
+
+   // EXERCISE
+   size_t allocations;
+   size_t frees;
+   {
+      AllocScope scope;
+      for (const Move& move : moves)
+      {
+         board.makeMove(move);
+         board.undoMove();
+      }
+      allocations = scope.getAllocations();
+      frees = scope.getFrees();
+   }
+
+   // VERIFY
+   assertUnit(allocations == 0);
+   assertUnit(frees == 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * BOARD COUNT MOVES
+ * Input : Kiwipete
+ * Output: 48 moves counted without allocating anything
+ **************************************/
+void TestAllocScope::boardCountMoves_none()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+   // EXERCISE
+   size_t allocations;
+   int count;
+   {
+      AllocScope scope;
+      count = board.countMoves();
+      allocations = scope.getAllocations();
+   }
+
+   // VERIFY
+   assertUnit(count == 48);
+   assertUnit(allocations == 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * PAWN GET MOVES
+ * Input : the e2 pawn of the initial position
+ * Output: two moves, and one allocation for each node of the set
+ **************************************/
+void TestAllocScope::pawnGetMoves_setNodes()
+{
+   // SETUP
+   Board board;
+   const Piece& pawn = board[Position("e2")];
+   set<Move> moves;
+
+   // EXERCISE
+   size_t allocations;
+   size_t frees;
+   {
+      AllocScope scope;
+      pawn.getMoves(moves, board);
+      allocations = scope.getAllocations();
+      frees = scope.getFrees();
+   }
+
+   // VERIFY
+   assertUnit(moves.size() == 2);
+   assertUnit(allocations == moves.size());
+   assertUnit(frees == 0);
+
+   // TEARDOWN
+   board.free();
+}
@@ -0,0 +1,54 @@
+/***********************************************************************
+ * Header File:
+ *    TEST ALLOC SCOPE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for AllocScope, and the allocations of the hot
+ *    paths that it measures
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+#include "allocScope.h"
+
+/***************************************************
+ * ALLOC SCOPE TEST
+ * Test the AllocScope class
+ ***************************************************/
+class TestAllocScope : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_empty);
+      runUnit(reset_zero);
+
+      // the rest need the counting operator new, built with ALLOC_SCOPE
+      if (AllocScope::enabled)
+      {
+         runUnit(count_newDelete);
+         runUnit(count_array);
+         runUnit(count_nested);
+         runUnit(count_afterClose);
+         runUnit(boardMove_captureWarm);
+         runUnit(boardMakeUndo_warm);
+         runUnit(boardCountMoves_none);
+         runUnit(pawnGetMoves_setNodes);
+      }
+
+      report("AllocScope");
+   }
+private:
+   void construct_empty();
+   void count_newDelete();
+   void count_array();
+   void count_nested();
+   void count_afterClose();
+   void reset_zero();
+   void boardMove_captureWarm();
+   void boardMakeUndo_warm();
+   void boardCountMoves_none();
+   void pawnGetMoves_setNodes();
+};
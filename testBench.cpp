@@ -0,0 +1,90 @@
+/***********************************************************************
+ * Source File:
+ *    TEST BENCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for Bench
+ ************************************************************************/
+
+#include "testBench.h"
+#include "bench.h"
+#include "board.h"
+#include <sstream>
+using namespace std;
+
+/*************************************
+ * GET POSITIONS fifty
+ * Input : the bench positions
+ * Output: fifty of them, starting from the initial position
+ **************************************/
+void TestBench::getPositions_fifty()
+{
+   // EXERCISE
+   const vector<const char*>& positions = Bench::getPositions();
+
+   // VERIFY
+   assertUnit(positions.size() == 50);
+   assertUnit(!positions.empty() && string(positions[0]) == FEN_INITIAL);
+}
+
+/*************************************
+ * RUN initial
+ * Input : the initial position at depth 3
+ * Output: the perft count 8902
+ **************************************/
+void TestBench::run_initial()
+{
+   // SETUP
+   Bench bench(3);
+
+   // EXERCISE
+   Bench::Result result = bench.run(FEN_INITIAL);
+
+   // VERIFY
+   assertUnit(result.nodes == 8902);
+   assertUnit(result.fen == FEN_INITIAL);
+   assertUnit(result.seconds >= 0.0);
+}
+
+/*************************************
+ * RUN signature
+ * Input : every position at depth 2
+ * Output: the known total. If this changes, the move
+ *         generators or the positions changed
+ **************************************/
+void TestBench::run_signature()
+{
+   // SETUP
+   Bench bench(2);
+   ostringstream sout;
+
+   // EXERCISE
+   vector<Bench::Result> results = bench.run(sout);
+
+   // VERIFY
+   assertUnit(results.size() == 50);
+   assertUnit(Bench::getNodes(results) == 40770);
+   assertUnit(sout.str().find(FEN_INITIAL) != string::npos);
+}
+
+/*************************************
+ * RUN search repeatable
+ * Input : the initial position searched twice at depth 3
+ * Output: the same count both times, so the search
+ *         signature can be compared between builds
+ **************************************/
+void TestBench::run_searchRepeatable()
+{
+   // SETUP
+   Bench bench(3, Bench::SEARCH);
+
+   // EXERCISE
+   Bench::Result first = bench.run(FEN_INITIAL);
+   Bench::Result second = bench.run(FEN_INITIAL);
+
+   // VERIFY
+   assertUnit(first.nodes > 0);
+   assertUnit(first.nodes == second.nodes);
+   assertUnit(first.nodes < 8902);
+}
@@ -0,0 +1,35 @@
+/***********************************************************************
+ * Header File:
+ *    TEST BENCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for Bench
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * BENCH TEST
+ * Test the Bench class
+ ***************************************************/
+class TestBench : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(getPositions_fifty);
+      runUnit(run_initial);
+      runUnit(run_signature);
+      runUnit(run_searchRepeatable);
+
+      report("Bench");
+   }
+private:
+   void getPositions_fifty();
+   void run_initial();
+   void run_signature();
+   void run_searchRepeatable();
+};
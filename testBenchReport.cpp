@@ -0,0 +1,215 @@
+/***********************************************************************
+ * Source File:
+ *    TEST BENCH REPORT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for BenchReport
+ ************************************************************************/
+
+#include "testBenchReport.h"
+#include "benchReport.h"
+#include <sstream>
+using namespace std;
+
+/***************************************************
+ * MAKE RECORD
+ * A record with just the fields compare() looks at
+ ***************************************************/
+static BenchReport::Record makeRecord(const string& name, double median, double p95)
+{
+   BenchReport::Record record;
+   record.name = name;
+   record.median = median;
+   record.p95 = p95;
+   return record;
+}
+
+/*************************************
+ * WRITE one line each
+ * Input : two records
+ * Output: two lines, each a JSON object
+ **************************************/
+void TestBenchReport::write_oneLineEach()
+{
+   // SETUP
+   vector<BenchReport::Record> records = { makeRecord("a", 1.0, 2.0), makeRecord("b", 3.0, 4.0) };
+   ostringstream sout;
+
+   // EXERCISE
+   BenchReport::write(sout, records);
+
+   // VERIFY
+   string text = sout.str();
+   assertUnit(text.find("{\"name\": \"a\"") == 0);
+   assertUnit(text.find("\n{\"name\": \"b\"") != string::npos);
+   assertUnit(text.find("\"median_ns\": 3") != string::npos);
+   assertUnit(text.back() == '\n');
+}
+
+/*************************************
+ * READ written
+ * Input : a record with every field set, written
+ * Output: the same record read back
+ **************************************/
+void TestBenchReport::read_written()
+{
+   // SETUP
+   BenchReport::Record record = makeRecord("Board::move capture", 187.25, 201.5);
+   record.revision = "c1324db";
+   record.iterations = 4096;
+   record.repetitions = 10;
+   record.mean = 190.125;
+   record.stdDev = 7.5;
+   record.min = 180.0;
+   record.allocations = 2.0;
+   record.bytes = 120.0;
+   stringstream stream;
+   BenchReport::write(stream, { record });
+
+   // EXERCISE
+   vector<BenchReport::Record> records = BenchReport::read(stream);
+
+   // VERIFY
+   assertUnit(records.size() == 1);
+   assertUnit(records[0].name == "Board::move capture");
+   assertUnit(records[0].revision == "c1324db");
+   assertUnit(records[0].iterations == 4096);
+   assertUnit(records[0].repetitions == 10);
+   assertEquals(records[0].median, 187.25);
+   assertEquals(records[0].p95, 201.5);
+   assertEquals(records[0].mean, 190.125);
+   assertEquals(records[0].stdDev, 7.5);
+   assertEquals(records[0].min, 180.0);
+   assertEquals(records[0].allocations, 2.0);
+   assertEquals(records[0].bytes, 120.0);
+}
+
+/*************************************
+ * READ quoted
+ * Input : a name with a quote and a backslash in it
+ * Output: the name read back unchanged
+ **************************************/
+void TestBenchReport::read_quoted()
+{
+   // SETUP
+   stringstream stream;
+   BenchReport::write(stream, { makeRecord("say \"hi\" \\ bye", 1.0, 1.0) });
+
+   // EXERCISE
+   vector<BenchReport::Record> records = BenchReport::read(stream);
+
+   // VERIFY
+   assertUnit(records.size() == 1);
+   assertUnit(records[0].name == "say \"hi\" \\ bye");
+}
+
+/*************************************
+ * READ skips other lines
+ * Input : a blank line, some text, a record with an unknown key
+ * Output: just the record
+ **************************************/
+void TestBenchReport::read_skipsOther()
+{
+   // SETUP
+   istringstream sin("\n"
+                     "Case  ns/op\n"
+                     "{\"name\": \"x\", \"color\": \"blue\", \"median_ns\": 5}\n");
+
+   // EXERCISE
+   vector<BenchReport::Record> records = BenchReport::read(sin);
+
+   // VERIFY
+   assertUnit(records.size() == 1);
+   assertUnit(records[0].name == "x");
+   assertEquals(records[0].median, 5.0);
+}
+
+/*************************************
+ * COMPARE regression
+ * Input : median 100 (p95 104) becomes 120, threshold 5%
+ * Output: a 20% regression
+ **************************************/
+void TestBenchReport::compare_regression()
+{
+   // EXERCISE
+   vector<BenchReport::Comparison> comparisons = BenchReport::compare(
+      { makeRecord("move", 100.0, 104.0) }, { makeRecord("move", 120.0, 125.0) }, 0.05);
+
+   // VERIFY
+   assertUnit(comparisons.size() == 1);
+   assertUnit(comparisons[0].status == BenchReport::REGRESSION);
+   assertEquals(comparisons[0].baseline, 100.0);
+   assertEquals(comparisons[0].current, 120.0);
+   assertEquals(comparisons[0].change, 0.2);
+}
+
+/*************************************
+ * COMPARE within threshold
+ * Input : median 100 becomes 104, threshold 5%
+ * Output: the same
+ **************************************/
+void TestBenchReport::compare_withinThreshold()
+{
+   // EXERCISE
+   vector<BenchReport::Comparison> comparisons = BenchReport::compare(
+      { makeRecord("move", 100.0, 101.0) }, { makeRecord("move", 104.0, 106.0) }, 0.05);
+
+   // VERIFY
+   assertUnit(comparisons.size() == 1);
+   assertUnit(comparisons[0].status == BenchReport::SAME);
+}
+
+/*************************************
+ * COMPARE within noise
+ * Input : median 100 becomes 110, threshold 5%, but
+ *         the baseline's own p95 was 130
+ * Output: the same, the case is too noisy to tell
+ **************************************/
+void TestBenchReport::compare_withinNoise()
+{
+   // EXERCISE
+   vector<BenchReport::Comparison> comparisons = BenchReport::compare(
+      { makeRecord("move", 100.0, 130.0) }, { makeRecord("move", 110.0, 140.0) }, 0.05);
+
+   // VERIFY
+   assertUnit(comparisons.size() == 1);
+   assertUnit(comparisons[0].status == BenchReport::SAME);
+}
+
+/*************************************
+ * COMPARE improvement
+ * Input : median 100 becomes 50 (p95 55), threshold 5%
+ * Output: an improvement
+ **************************************/
+void TestBenchReport::compare_improvement()
+{
+   // EXERCISE
+   vector<BenchReport::Comparison> comparisons = BenchReport::compare(
+      { makeRecord("move", 100.0, 104.0) }, { makeRecord("move", 50.0, 55.0) }, 0.05);
+
+   // VERIFY
+   assertUnit(comparisons.size() == 1);
+   assertUnit(comparisons[0].status == BenchReport::IMPROVEMENT);
+   assertEquals(comparisons[0].change, -0.5);
+}
+
+/*************************************
+ * COMPARE added and removed
+ * Input : baseline has "old", current has "new"
+ * Output: "new" is added, "old" is removed
+ **************************************/
+void TestBenchReport::compare_addedRemoved()
+{
+   // EXERCISE
+   vector<BenchReport::Comparison> comparisons = BenchReport::compare(
+      { makeRecord("old", 10.0, 11.0) }, { makeRecord("new", 20.0, 21.0) }, 0.05);
+
+   // VERIFY
+   assertUnit(comparisons.size() == 2);
+   assertUnit(comparisons[0].name == "new");
+   assertUnit(comparisons[0].status == BenchReport::ADDED);
+   assertUnit(comparisons[1].name == "old");
+   assertUnit(comparisons[1].status == BenchReport::REMOVED);
+   assertEquals(comparisons[1].baseline, 10.0);
+}
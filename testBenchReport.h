@@ -0,0 +1,45 @@
+/***********************************************************************
+ * Header File:
+ *    TEST BENCH REPORT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for BenchReport
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * BENCH REPORT TEST
+ * Test the BenchReport class
+ ***************************************************/
+class TestBenchReport : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(write_oneLineEach);
+      runUnit(read_written);
+      runUnit(read_quoted);
+      runUnit(read_skipsOther);
+      runUnit(compare_regression);
+      runUnit(compare_withinThreshold);
+      runUnit(compare_withinNoise);
+      runUnit(compare_improvement);
+      runUnit(compare_addedRemoved);
+
+      report("BenchReport");
+   }
+private:
+   void write_oneLineEach();
+   void read_written();
+   void read_quoted();
+   void read_skipsOther();
+   void compare_regression();
+   void compare_withinThreshold();
+   void compare_withinNoise();
+   void compare_improvement();
+   void compare_addedRemoved();
+};
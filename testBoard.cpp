@@ -12,6 +12,7 @@
 #include "position.h"
 #include "piece.h"
 #include "board.h"
+#include "perftSuite.h"
 #include <cassert>
 
 
@@ -1478,3 +1479,622 @@ void TestBoard::construct_default()
    assertUnit(board.board[0][7] != nullptr); // black rook exists
    
 }  // TEARDOWN
+
+/********************************************************
+ *    UNDO MOVE capture: e5c6r then take it back
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * 6       R             6       6       R             6
+ * 5          (n)        5  -->  5          (n)        5
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::undoMove_capture()
+{
+   // SETUP
+   Board board;
+   board.readFEN("4k3/8/2r5/4N3/8/8/8/4K3 w - - 0 1");
+   Piece* pKnight = board.board[4][4];
+   Piece* pRook = board.board[2][5];
+   Move e5c6r("e5c6r");
+   e5c6r.setWhiteMove(true);
+   board.makeMove(e5c6r);
+
+   // EXERCISE
+   board.undoMove();
+
+   // VERIFY
+   assertUnit(pKnight == board.board[4][4]);
+   assertUnit(pRook == board.board[2][5]);
+   assertUnit(0 == board.numMoves);
+   assertUnit(0 == pKnight->nMoves);
+   assertUnit(4 == pKnight->getPosition().getCol());
+   assertUnit(4 == pKnight->getPosition().getRow());
+   assertUnit(board.history.empty());
+   assertUnit(board.getFEN() == "4k3/8/2r5/4N3/8/8/8/4K3 w - - 0 1");
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    UNDO MOVE en passant: e5f6E then take it back
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * 6                     6       6                     6
+ * 5          (p)P       5  -->  5          (p)P       5
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::undoMove_enpassant()
+{
+   // SETUP
+   Board board;
+   const char* fen = "4k3/8/8/4Pp2/8/8/8/4K3 w - f6 0 1";
+   board.readFEN(fen);
+   Move e5f6E("e5f6E");
+   e5f6E.setWhiteMove(true);
+   board.makeMove(e5f6E);
+   assertUnit(SPACE == board.board[5][4]->getType());
+
+   // EXERCISE
+   board.undoMove();
+
+   // VERIFY
+   assertUnit(PAWN == board.board[4][4]->getType());
+   assertUnit(PAWN == board.board[5][4]->getType());
+   assertUnit(SPACE == board.board[5][5]->getType());
+   assertUnit(board.getFEN() == fen);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    UNDO MOVE castle: e1g1c then take it back
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * 1          (k)    r   1  -->  1          (k)    r   1
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::undoMove_castle()
+{
+   // SETUP
+   Board board;
+   const char* fen = "4k3/8/8/8/8/8/8/4K2R w K - 0 1";
+   board.readFEN(fen);
+   Move e1g1c("e1g1c");
+   e1g1c.setWhiteMove(true);
+   board.makeMove(e1g1c);
+   assertUnit(ROOK == board.board[5][0]->getType());
+
+   // EXERCISE
+   board.undoMove();
+
+   // VERIFY
+   assertUnit(KING == board.board[4][0]->getType());
+   assertUnit(ROOK == board.board[7][0]->getType());
+   assertUnit(7 == board.board[7][0]->getPosition().getCol());
+   assertUnit(board.getFEN() == fen);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    UNDO MOVE promotion: a7a8 then take it back
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * 8   .                 8       8   .                 8
+ * 7  (p)                7  -->  7  (p)                7
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::undoMove_promotion()
+{
+   // SETUP
+   Board board;
+   const char* fen = "4k3/P7/8/8/8/8/8/4K3 w - - 0 1";
+   board.readFEN(fen);
+   Piece* pPawn = board.board[0][6];
+   Move a7a8("a7a8");
+   a7a8.setWhiteMove(true);
+   board.makeMove(a7a8);
+   assertUnit(QUEEN == board.board[0][7]->getType());
+
+   // EXERCISE
+   board.undoMove();
+
+   // VERIFY
+   assertUnit(pPawn == board.board[0][6]);
+   assertUnit(SPACE == board.board[0][7]->getType());
+   assertUnit(board.getFEN() == fen);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    READ FEN of the initial position
+ ********************************************************/
+void TestBoard::readFEN_initial()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+
+   // EXERCISE
+   board.readFEN(FEN_INITIAL);
+
+   // VERIFY
+   assertUnit(0 == board.numMoves);
+   assertUnit(ROOK == board.board[0][0]->getType());
+   assertUnit(true == board.board[0][0]->isWhite());
+   assertUnit(KING == board.board[4][7]->getType());
+   assertUnit(false == board.board[4][7]->isWhite());
+   assertUnit(PAWN == board.board[3][1]->getType());
+   assertUnit(0 == board.board[3][1]->nMoves);
+   assertUnit(SPACE == board.board[3][3]->getType());
+   assertUnit(board.getFEN() == FEN_INITIAL);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    GET FEN after 1. e4: black to move, en passant on e3
+ ********************************************************/
+void TestBoard::getFEN_enpassant()
+{
+   // SETUP
+   Board board;
+   Move e2e4("e2e4");
+   e2e4.setWhiteMove(true);
+   board.move(e2e4);
+
+   // EXERCISE
+   string fen = board.getFEN();
+
+   // VERIFY
+   assertUnit(fen == "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    IN CHECK from a rook on an open file
+ ********************************************************/
+void TestBoard::inCheck_rook()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4r1k1/8/8/8/8/8/8/4K3 w - - 0 1");
+
+   // EXERCISE
+   bool white = board.inCheck(true);
+   bool black = board.inCheck(false);
+
+   // VERIFY
+   assertUnit(true == white);
+   assertUnit(false == black);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    IN CHECK where the rook is blocked by a pawn
+ ********************************************************/
+void TestBoard::inCheck_blocked()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4r1k1/8/8/8/8/8/4P3/4K3 w - - 0 1");
+
+   // EXERCISE
+   bool white = board.inCheck(true);
+
+   // VERIFY
+   assertUnit(false == white);
+   assertUnit(false == board.isAttacked(Position(4, 0), false));
+   assertUnit(true == board.isAttacked(Position(4, 2), false));
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    COUNT MOVES in the initial position: 16 pawn and 4 knight moves
+ ********************************************************/
+void TestBoard::countMoves_initial()
+{
+   // SETUP
+   Board board;
+
+   // EXERCISE
+   int count = board.countMoves();
+
+   // VERIFY
+   assertUnit(20 == count);
+   assertUnit(board.getFEN() == FEN_INITIAL);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    COUNT MOVES with the e2 knight pinned by the e8 rook
+ * +---a-b-c-d-e-f-g-h---+
+ * 8             R       8
+ * 2             n       2
+ * 1            (k)      1
+ * +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::countMoves_pinned()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4r1k1/8/8/8/8/8/4N3/4K3 w - - 0 1");
+   vector<Move> moves;
+   board.getMoves(moves);
+
+   // EXERCISE
+   int count = board.countMoves();
+
+   // VERIFY
+   assertUnit(4 == count);   // Kd1, Kd2, Kf1, Kf2 and no knight moves
+   assertUnit((int)moves.size() == count);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    GENERATE CAPTURES in the initial position: there are none
+ ********************************************************/
+void TestBoard::generateCaptures_initial()
+{
+   // SETUP
+   Board board;
+   vector<Move> moves;
+
+   // EXERCISE
+   board.generateCaptures(moves);
+
+   // VERIFY
+   assertUnit(moves.empty());
+   assertUnit(board.getFEN() == FEN_INITIAL);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    GENERATE CAPTURES in positions with captures, en passant,
+ *    promotions, and pins: exactly the moves of generateMoves()
+ *    that capture or promote, in the same order
+ ********************************************************/
+void TestBoard::generateCaptures_tactical()
+{
+   const char* fens[] =
+   {
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+      "4r1k1/8/8/8/8/8/4N3/4K3 w - - 0 1",
+   };
+   for (const char* fen : fens)
+   {
+      // SETUP
+      Board board(nullptr, true /*noreset*/);
+      board.readFEN(fen);
+      string before = board.getFEN();
+      vector<Move> all;
+      board.generateMoves(all);
+      vector<Move> expected;
+      for (const Move& move : all)
+         if (move.getCapture() != SPACE || move.getPromotion() != SPACE)
+            expected.push_back(move);
+      vector<Move> moves;
+
+      // EXERCISE
+      board.generateCaptures(moves);
+
+      // VERIFY
+      assertUnit(moves.size() == expected.size());
+      for (size_t i = 0; i < moves.size() && i < expected.size(); i++)
+      {
+         assertUnit(moves[i] == expected[i]);
+         assertUnit(moves[i].getPromotion() == expected[i].getPromotion());
+      }
+      assertUnit(board.getFEN() == before);
+
+      // TEARDOWN
+      board.free();
+   }
+}
+
+/********************************************************
+ *    SEE of a rook taking an undefended pawn
+ * +---a-b-c-d-e-f-g-h---+
+ * 8           k         8
+ * 5         p           5
+ * 1        (R)K         1
+ * +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::see_undefended()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4k3/8/8/3p4/8/8/8/3RK3 w - - 0 1");
+   string before = board.getFEN();
+   Move move("d1d5");
+
+   // EXERCISE
+   int value = board.see(move);
+
+   // VERIFY
+   assertUnit(100 == value);
+   assertUnit(board.seeGE(move, 100));
+   assertUnit(!board.seeGE(move, 101));
+   assertUnit(board.getFEN() == before);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    SEE of a rook taking a pawn the c6 pawn defends
+ * +---a-b-c-d-e-f-g-h---+
+ * 8           k         8
+ * 6       p             6
+ * 5         p           5
+ * 1        (R)K         1
+ * +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::see_defended()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4k3/8/2p5/3p4/8/8/8/3RK3 w - - 0 1");
+   Move move("d1d5");
+
+   // EXERCISE
+   int value = board.see(move);
+
+   // VERIFY
+   assertUnit(100 - 500 == value);
+   assertUnit(!board.seeGE(move, 0));
+   assertUnit(board.seeGE(move, -400));
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    SEE through a stack of rooks: the d1 rook joins in once
+ *    the d2 rook has gone
+ * +---a-b-c-d-e-f-g-h---+
+ * 8         r k         8
+ * 5         p           5
+ * 2        (R)          2
+ * 1         R K         1
+ * +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::see_xray()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("3rk3/8/8/3p4/8/8/3R4/3RK3 w - - 0 1");
+   string before = board.getFEN();
+   Move move("d2d5");
+
+   // EXERCISE
+   int value = board.see(move);
+
+   // VERIFY
+   assertUnit(100 == value);   // RxP RxR RxR
+   assertUnit(board.seeGE(move, 100));
+   assertUnit(!board.seeGE(move, 101));
+   assertUnit(board.getFEN() == before);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    SEE of an en passant capture: the pawn taken is not on
+ *    the destination
+ * +---a-b-c-d-e-f-g-h---+
+ * 8           k         8
+ * 5         p(P)        5
+ * 1           K         1
+ * +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::see_enpassant()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 2");
+   Move move("e5d6");
+
+   // EXERCISE
+   int value = board.see(move);
+
+   // VERIFY
+   assertUnit(100 == value);
+   assertUnit(board.seeGE(move, 100));
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ *    SEE of a pawn taking a rook and promoting, then with a
+ *    knight that takes the queen back
+ * +---a-b-c-d-e-f-g-h---+
+ * 8     r     k         8
+ * 7  (P)                7
+ * 6       n             6
+ * 1           K         1
+ * +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::see_promotion()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("1r2k3/P7/8/8/8/8/8/4K3 w - - 0 1");
+   Board boardDefended(nullptr, true /*noreset*/);
+   boardDefended.readFEN("1r2k3/P7/2n5/8/8/8/8/4K3 w - - 0 1");
+   Move move("a7b8");
+   move.setPromotion(QUEEN);
+
+   // EXERCISE
+   int value = board.see(move);
+   int valueDefended = boardDefended.see(move);
+
+   // VERIFY
+   assertUnit(500 + 900 - 100 == value);
+   assertUnit(500 + 900 - 100 - 900 == valueDefended);
+   assertUnit(boardDefended.seeGE(move, 400));
+   assertUnit(!boardDefended.seeGE(move, 401));
+
+   // TEARDOWN
+   board.free();
+   boardDefended.free();
+}
+
+/********************************************************
+ *    SEE GE agrees with SEE for every capture of several
+ *    positions, at thresholds either side of each answer
+ ********************************************************/
+void TestBoard::seeGE_agrees()
+{
+   const char* fens[] =
+   {
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      "r1bq1r1k/1pp1n1pp/1p1p4/4p2Q/4Pp2/1BNP4/PPP2PPP/3R1RK1 w - - 2 14",
+      "4rrk1/1p1nq3/p7/2p1P1pp/3P2bp/3Q1Bn1/PPPB4/1K2R1NR w - - 40 21",
+   };
+   const int thresholds[] = { -1000, -400, -1, 0, 1, 100, 400, 1000 };
+   for (const char* fen : fens)
+   {
+      // SETUP
+      Board board(nullptr, true /*noreset*/);
+      board.readFEN(fen);
+      vector<Move> moves;
+      board.generateCaptures(moves);
+
+      for (const Move& move : moves)
+      {
+         // EXERCISE
+         int value = board.see(move);
+
+         // VERIFY
+         for (int threshold : thresholds)
+            assertUnit(board.seeGE(move, threshold) == (value >= threshold));
+         assertUnit(board.seeGE(move, value));
+         assertUnit(!board.seeGE(move, value + 1));
+      }
+
+      // TEARDOWN
+      board.free();
+   }
+}
+
+/********************************************************
+ *    GET HASH of the same position reached two ways:
+ *    1. Nf3 Nf6 2. Nc3 and 1. Nc3 Nf6 2. Nf3
+ ********************************************************/
+void TestBoard::getHash_transposition()
+{
+   // SETUP
+   Board board1;
+   Board board2;
+   Board boardInitial;
+   const char* line1[] = { "g1f3", "g8f6", "b1c3" };
+   const char* line2[] = { "b1c3", "g8f6", "g1f3" };
+   for (int i = 0; i < 3; i++)
+   {
+      Move move1(line1[i]);
+      Move move2(line2[i]);
+      move1.setWhiteMove(board1.whiteTurn());
+      move2.setWhiteMove(board2.whiteTurn());
+      board1.move(move1);
+      board2.move(move2);
+   }
+
+   // EXERCISE
+   uint64_t hash1 = board1.getHash();
+   uint64_t hash2 = board2.getHash();
+
+   // VERIFY
+   assertUnit(hash1 == hash2);
+   assertUnit(hash1 != boardInitial.getHash());
+
+   // TEARDOWN
+   board1.free();
+   board2.free();
+   boardInitial.free();
+}
+
+/********************************************************
+ *    GET HASH of the same pieces with the other side to move
+ ********************************************************/
+void TestBoard::getHash_sideToMove()
+{
+   // SETUP
+   Board boardWhite(nullptr, true /*noreset*/);
+   Board boardBlack(nullptr, true /*noreset*/);
+   boardWhite.readFEN("4k3/8/8/8/8/8/8/4K3 w - - 0 1");
+   boardBlack.readFEN("4k3/8/8/8/8/8/8/4K3 b - - 0 1");
+
+   // EXERCISE
+   uint64_t hashWhite = boardWhite.getHash();
+   uint64_t hashBlack = boardBlack.getHash();
+
+   // VERIFY
+   assertUnit(hashWhite != hashBlack);
+
+   // TEARDOWN
+   boardWhite.free();
+   boardBlack.free();
+}
+
+/********************************************************
+ *    GET HASH kept by makeMove and undoMove agrees with
+ *    the hash from scratch, two plies deep from every perft
+ *    suite position: castling, en passant, and promotion
+ ********************************************************/
+void TestBoard::getHash_incremental()
+{
+   for (const PerftSuite::Case& test : PerftSuite::getCases())
+   {
+      // SETUP
+      Board board(nullptr, true /*noreset*/);
+      board.readFEN(test.fen);
+      uint64_t hashRoot = board.getHash();
+      vector<Move> moves;
+      vector<Move> replies;
+      bool agree = hashRoot == board.computeHash();
+
+      // EXERCISE
+      board.generateMoves(moves);
+      for (const Move& move : moves)
+      {
+         board.makeMove(move);
+         agree = agree && board.getHash() == board.computeHash();
+         board.generateMoves(replies);
+         for (const Move& reply : replies)
+         {
+            board.makeMove(reply);
+            agree = agree && board.getHash() == board.computeHash();
+            board.undoMove();
+         }
+         board.undoMove();
+      }
+
+      // VERIFY
+      assertUnit(agree);
+      assertUnit(board.getHash() == hashRoot);
+
+      // TEARDOWN
+      board.free();
+   }
+}
@@ -23,48 +23,73 @@ public:
    void run()
    {
       //construct
-      construct_default();
-      construct_dummyBoard();
-      construct_emptyBoard();
+      runUnit(construct_default);
+      runUnit(construct_dummyBoard);
+      runUnit(construct_emptyBoard);
 
       //move
-      move_pawnSimple();
-      move_pawnCapture();
-      move_pawnDouble();
-      move_pawnEnpassant();
-      move_pawnPromotion();
-      move_rookSlide();
-      move_rookAttack();
-      move_bishopSlide();
-      move_bishopAttack();
-      move_knightMove();
-      move_knightAttack();
-      move_queenSlide();
-      move_queenAttack();
-      move_kingMove();
-      move_kingAttack();
-      move_kingShortCastle();
-      move_kingLongCastle();
+      runUnit(move_pawnSimple);
+      runUnit(move_pawnCapture);
+      runUnit(move_pawnDouble);
+      runUnit(move_pawnEnpassant);
+      runUnit(move_pawnPromotion);
+      runUnit(move_rookSlide);
+      runUnit(move_rookAttack);
+      runUnit(move_bishopSlide);
+      runUnit(move_bishopAttack);
+      runUnit(move_knightMove);
+      runUnit(move_knightAttack);
+      runUnit(move_queenSlide);
+      runUnit(move_queenAttack);
+      runUnit(move_kingMove);
+      runUnit(move_kingAttack);
+      runUnit(move_kingShortCastle);
+      runUnit(move_kingLongCastle);
 
       // Get Current Move
-      getCurrentMove_initial();
-      getCurrentMove_second();
-      getCurrentMove_middleWhite();
-      getCurrentMove_middleBlack();
+      runUnit(getCurrentMove_initial);
+      runUnit(getCurrentMove_second);
+      runUnit(getCurrentMove_middleWhite);
+      runUnit(getCurrentMove_middleBlack);
 
       // Whites Turn?
-      whiteTurn_initial();
-      whiteTurn_second();
-      whiteTurn_middleWhite();
-      whiteTurn_middleBlack();
+      runUnit(whiteTurn_initial);
+      runUnit(whiteTurn_second);
+      runUnit(whiteTurn_middleWhite);
+      runUnit(whiteTurn_middleBlack);
 
       // fetch and get
-      fetch_a1();
-      fetch_h8();
-      fetch_a8();
-      set_a1();
-      set_h8();
-      set_a8();
+      runUnit(fetch_a1);
+      runUnit(fetch_h8);
+      runUnit(fetch_a8);
+      runUnit(set_a1);
+      runUnit(set_h8);
+      runUnit(set_a8);
+
+      // make and undo
+      runUnit(undoMove_capture);
+      runUnit(undoMove_enpassant);
+      runUnit(undoMove_castle);
+      runUnit(undoMove_promotion);
+
+      // FEN and check
+      runUnit(readFEN_initial);
+      runUnit(getFEN_enpassant);
+      runUnit(inCheck_rook);
+      runUnit(inCheck_blocked);
+      runUnit(countMoves_initial);
+      runUnit(countMoves_pinned);
+      runUnit(generateCaptures_initial);
+      runUnit(generateCaptures_tactical);
+      runUnit(see_undefended);
+      runUnit(see_defended);
+      runUnit(see_xray);
+      runUnit(see_enpassant);
+      runUnit(see_promotion);
+      runUnit(seeGE_agrees);
+      runUnit(getHash_transposition);
+      runUnit(getHash_sideToMove);
+      runUnit(getHash_incremental);
 
       report("Board");
    }
@@ -109,5 +134,27 @@ private:
    void set_h8();
    void set_a8();
 
+   void undoMove_capture();
+   void undoMove_enpassant();
+   void undoMove_castle();
+   void undoMove_promotion();
+
+   void readFEN_initial();
+   void getFEN_enpassant();
+   void inCheck_rook();
+   void inCheck_blocked();
+   void countMoves_initial();
+   void countMoves_pinned();
+   void generateCaptures_initial();
+   void generateCaptures_tactical();
+   void see_undefended();
+   void see_defended();
+   void see_xray();
+   void see_enpassant();
+   void see_promotion();
+   void seeGE_agrees();
+   void getHash_transposition();
+   void getHash_sideToMove();
+   void getHash_incremental();
 };
 
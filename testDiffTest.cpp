@@ -0,0 +1,175 @@
+/***********************************************************************
+ * Source File:
+ *    TEST DIFF TEST
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for DiffTest
+ ************************************************************************/
+
+#include "testDiffTest.h"
+#include "diffTest.h"
+#include "perftSuite.h"
+#include "board.h"
+using namespace std;
+
+/***************************************************
+ * WITHOUT CASTLING
+ * An optimized generator with a bug: it never castles
+ ***************************************************/
+static void withoutCastling(Board& board, vector<Move>& moves)
+{
+   board.generateMoves(moves);
+   vector<Move> kept;
+   for (const Move& move : moves)
+      if (!move.getCastleK() && !move.getCastleQ())
+         kept.push_back(move);
+   moves = kept;
+}
+
+/*************************************
+ * DESCRIBE castle
+ * Input : white king-side castle
+ * Output: "e1g1 w O-O"
+ **************************************/
+void TestDiffTest::describe_castle()
+{
+   // SETUP
+   Move move;
+   move.setSrc(Position("e1"));
+   move.setDest(Position("g1"));
+   move.setWhiteMove(true);
+   move.setCastle(true);
+
+   // EXERCISE
+   string text = DiffTest::describe(move);
+
+   // VERIFY
+   assertUnit(text == "e1g1 w O-O");
+}
+
+/*************************************
+ * DESCRIBE en passant
+ * Input : black pawn d4 takes e3 en passant
+ * Output: "d4e3 b xp e.p."
+ **************************************/
+void TestDiffTest::describe_enpassant()
+{
+   // SETUP
+   Move move;
+   move.setSrc(Position("d4"));
+   move.setDest(Position("e3"));
+   move.setWhiteMove(false);
+   move.setCapture(PAWN);
+   move.setEnPassant();
+
+   // EXERCISE
+   string text = DiffTest::describe(move);
+
+   // VERIFY
+   assertUnit(text == "d4e3 b xp e.p.");
+}
+
+/*************************************
+ * COMPARE suite agrees
+ * Input : every perft suite position
+ * Output: getMoves() and generateMoves() agree on each
+ **************************************/
+void TestDiffTest::compare_suiteAgrees()
+{
+   // SETUP
+   DiffTest diffTest;
+   Board board(nullptr, true /*noreset*/);
+   vector<string> onlyReference;
+   vector<string> onlyOptimized;
+
+   for (const PerftSuite::Case& test : PerftSuite::getCases())
+   {
+      board.readFEN(test.fen);
+
+      // EXERCISE
+      bool same = diffTest.compare(board, onlyReference, onlyOptimized);
+
+      // VERIFY
+      assertUnit(same);
+      assertUnit(onlyReference.empty());
+      assertUnit(onlyOptimized.empty());
+   }
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COMPARE missing castle
+ * Input : Kiwipete, against a generator that never castles
+ * Output: the two castles are only in the reference
+ **************************************/
+void TestDiffTest::compare_missingCastle()
+{
+   // SETUP
+   DiffTest diffTest([](Board& board, vector<Move>& moves) { board.getMoves(moves); },
+                     withoutCastling);
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   vector<string> onlyReference;
+   vector<string> onlyOptimized;
+
+   // EXERCISE
+   bool same = diffTest.compare(board, onlyReference, onlyOptimized);
+
+   // VERIFY
+   assertUnit(!same);
+   assertUnit(onlyReference.size() == 2);
+   assertUnit(onlyReference.size() == 2 && onlyReference[0] == "e1c1 w O-O-O");
+   assertUnit(onlyReference.size() == 2 && onlyReference[1] == "e1g1 w O-O");
+   assertUnit(onlyOptimized.empty());
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * RUN agrees
+ * Input : 12 short games on 2 threads
+ * Output: all 12 played, no difference
+ **************************************/
+void TestDiffTest::run_agrees()
+{
+   // SETUP
+   DiffTest diffTest;
+   diffTest.setMaxPlies(20);
+
+   // EXERCISE
+   DiffTest::Result result = diffTest.run(60.0 /*seconds*/, 2 /*threads*/, 7 /*seed*/, 12 /*games*/);
+
+   // VERIFY
+   assertUnit(!result.diverged);
+   assertUnit(result.games == 12);
+   assertUnit(result.positions > 12);
+   assertUnit(result.fen.empty());
+}
+
+/*************************************
+ * RUN finds divergence
+ * Input : games against a generator that never castles
+ * Output: a difference, at a position where castling is legal
+ **************************************/
+void TestDiffTest::run_findsDivergence()
+{
+   // SETUP
+   DiffTest diffTest([](Board& board, vector<Move>& moves) { board.getMoves(moves); },
+                     withoutCastling);
+   diffTest.setMaxPlies(40);
+
+   // EXERCISE
+   DiffTest::Result result = diffTest.run(60.0 /*seconds*/, 2 /*threads*/, 7 /*seed*/, 200 /*games*/);
+
+   // VERIFY
+   assertUnit(result.diverged);
+   assertUnit(!result.fen.empty());
+   assertUnit(!result.onlyReference.empty());
+   assertUnit(result.onlyOptimized.empty());
+   for (const string& move : result.onlyReference)
+      assertUnit(move.find("O-O") != string::npos);
+}
@@ -0,0 +1,39 @@
+/***********************************************************************
+ * Header File:
+ *    TEST DIFF TEST
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for DiffTest
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * DIFF TEST TEST
+ * Test the DiffTest class
+ ***************************************************/
+class TestDiffTest : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(describe_castle);
+      runUnit(describe_enpassant);
+      runUnit(compare_suiteAgrees);
+      runUnit(compare_missingCastle);
+      runUnit(run_agrees);
+      runUnit(run_findsDivergence);
+
+      report("DiffTest");
+   }
+private:
+   void describe_castle();
+   void describe_enpassant();
+   void compare_suiteAgrees();
+   void compare_missingCastle();
+   void run_agrees();
+   void run_findsDivergence();
+};
@@ -0,0 +1,119 @@
+/***********************************************************************
+ * Source File:
+ *    TEST HASH MEMORY
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for HashMemory
+ ************************************************************************/
+
+#include "testHashMemory.h"
+#include "hashMemory.h"
+#include <cstdint>
+#include <cstring>
+using namespace std;
+
+/*************************************
+ * CONSTRUCT small
+ * Input : less than a huge page
+ * Output: from the heap, aligned to a cache line
+ **************************************/
+void TestHashMemory::construct_small()
+{
+   // SETUP
+   // EXERCISE
+   HashMemory memory(1000);
+
+   // VERIFY
+   assertUnit(memory.get() != nullptr);
+   assertUnit(memory.getBytes() == 1000);
+   assertUnit(memory.getMode() == HashMemory::HEAP);
+   assertUnit(((uintptr_t)memory.get() & 63) == 0);
+}  // TEARDOWN
+
+/*************************************
+ * CONSTRUCT large
+ * Input : four megabytes
+ * Output: mapped pages rather than the heap, starting on a
+ *         huge page boundary so each can be a huge page
+ **************************************/
+void TestHashMemory::construct_large()
+{
+   // SETUP
+   // EXERCISE
+   HashMemory memory(4 << 20);
+
+   // VERIFY
+   assertUnit(memory.get() != nullptr);
+   assertUnit(memory.getBytes() == 4 << 20);
+#ifndef _WIN32
+   assertUnit(memory.getMode() != HashMemory::HEAP);
+   assertUnit(((uintptr_t)memory.get() & (HashMemory::HUGE_PAGE_SIZE - 1)) == 0);
+#endif
+}  // TEARDOWN
+
+/*************************************
+ * CLEAR one thread
+ * Input : a small block written all over
+ * Output: every byte zero
+ **************************************/
+void TestHashMemory::clear_oneThread()
+{
+   // SETUP
+   HashMemory memory(1000);
+   memset(memory.get(), 0xab, 1000);
+
+   // EXERCISE
+   memory.clear(1);
+
+   // VERIFY
+   const unsigned char* p = (const unsigned char*)memory.get();
+   size_t nonzero = 0;
+   for (size_t i = 0; i < 1000; i++)
+      nonzero += p[i] != 0;
+   assertUnit(nonzero == 0);
+}  // TEARDOWN
+
+/*************************************
+ * CLEAR threads
+ * Input : a little over three huge pages written all over,
+ *         cleared by three threads
+ * Output: every byte zero, the last partial page included
+ **************************************/
+void TestHashMemory::clear_threads()
+{
+   // SETUP
+   size_t bytes = 3 * HashMemory::HUGE_PAGE_SIZE + 4096;
+   HashMemory memory(bytes);
+   memset(memory.get(), 0xab, bytes);
+
+   // EXERCISE
+   memory.clear(3);
+
+   // VERIFY
+   const unsigned char* p = (const unsigned char*)memory.get();
+   size_t nonzero = 0;
+   for (size_t i = 0; i < bytes; i++)
+      nonzero += p[i] != 0;
+   assertUnit(nonzero == 0);
+}  // TEARDOWN
+
+/*************************************
+ * DESCRIBE mode
+ * Input : a small block
+ * Output: the size, where it came from, and the NUMA nodes
+ **************************************/
+void TestHashMemory::describe_mode()
+{
+   // SETUP
+   HashMemory memory(1 << 10);
+
+   // EXERCISE
+   string text = memory.describe();
+
+   // VERIFY
+   assertUnit(text.find("1 KB") == 0);
+   assertUnit(text.find("heap") != string::npos);
+   assertUnit(text.find("NUMA node") != string::npos);
+   assertUnit(HashMemory::getNumNodes() >= 1);
+}  // TEARDOWN
@@ -0,0 +1,37 @@
+/***********************************************************************
+ * Header File:
+ *    TEST HASH MEMORY
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for HashMemory
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * HASH MEMORY TEST
+ * Test the HashMemory class
+ ***************************************************/
+class TestHashMemory : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_small);
+      runUnit(construct_large);
+      runUnit(clear_oneThread);
+      runUnit(clear_threads);
+      runUnit(describe_mode);
+
+      report("HashMemory");
+   }
+private:
+   void construct_small();
+   void construct_large();
+   void clear_oneThread();
+   void clear_threads();
+   void describe_mode();
+};
@@ -492,6 +492,130 @@ void TestKing::getMoves_whiteCastleRookMoved()
    board.board[0][0] = nullptr;
 }
 
+/*************************************
+ * GET MOVES : castle through check
+ * The black rook on f8 attacks f1, which the king must cross
+ * to castle king-side. Queen-side is still fine
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8             R       8
+ * 7                     7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1   r     .(k).   r   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ **************************************/
+void TestKing::getMoves_whiteCastleThroughCheck()
+{
+   // SETUP
+   BoardEmpty board;
+   King king(4, 0, true); // e1
+   king.fWhite = true;
+   king.position.colRow = 0x40;
+   king.nMoves = 0;
+   board.board[4][0] = &king;
+
+   Rook rookKingSide(7, 0, true); // h1
+   rookKingSide.fWhite = true;
+   rookKingSide.nMoves = 0;
+   board.board[7][0] = &rookKingSide;
+
+   Rook rookQueenSide(0, 0, true); // a1
+   rookQueenSide.fWhite = true;
+   rookQueenSide.nMoves = 0;
+   board.board[0][0] = &rookQueenSide;
+
+   Black rookBlack(ROOK);
+   board.board[5][7] = &rookBlack; // f8
+
+   set<Move> moves;
+
+   // EXERCISE
+   king.getMoves(moves, board);
+
+   // VERIFY
+   bool foundKingSideCastle = false;
+   bool foundQueenSideCastle = false;
+   for (const Move& move : moves)
+   {
+      if (move.getCastleK())
+         foundKingSideCastle = true;
+      if (move.getCastleQ())
+         foundQueenSideCastle = true;
+   }
+   assertUnit(foundKingSideCastle == false);
+   assertUnit(foundQueenSideCastle == true);
+
+   // TEARDOWN
+   board.board[4][0] = nullptr;
+   board.board[7][0] = nullptr;
+   board.board[0][0] = nullptr;
+   board.board[5][7] = nullptr;
+}
+
+/*************************************
+ * GET MOVES : castle in check
+ * The black rook on e8 gives check, so the king cannot castle
+ * to either side
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8           R         8
+ * 7                     7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1   r     .(k).   r   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ **************************************/
+void TestKing::getMoves_whiteCastleInCheck()
+{
+   // SETUP
+   BoardEmpty board;
+   King king(4, 0, true); // e1
+   king.fWhite = true;
+   king.position.colRow = 0x40;
+   king.nMoves = 0;
+   board.board[4][0] = &king;
+
+   Rook rookKingSide(7, 0, true); // h1
+   rookKingSide.fWhite = true;
+   rookKingSide.nMoves = 0;
+   board.board[7][0] = &rookKingSide;
+
+   Rook rookQueenSide(0, 0, true); // a1
+   rookQueenSide.fWhite = true;
+   rookQueenSide.nMoves = 0;
+   board.board[0][0] = &rookQueenSide;
+
+   Black rookBlack(ROOK);
+   board.board[4][7] = &rookBlack; // e8
+
+   set<Move> moves;
+
+   // EXERCISE
+   king.getMoves(moves, board);
+
+   // VERIFY
+   for (const Move& move : moves)
+   {
+      assertUnit(move.getCastleK() == false);
+      assertUnit(move.getCastleQ() == false);
+   }
+
+   // TEARDOWN
+   board.board[4][0] = nullptr;
+   board.board[7][0] = nullptr;
+   board.board[0][0] = nullptr;
+   board.board[4][7] = nullptr;
+}
+
 /*************************************
  * GET TYPE : king
  * Input:
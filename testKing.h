@@ -24,16 +24,18 @@ public:
 
    void run()
    {
-      getMoves_blocked();
-      getMoves_capture();
-      getMoves_free();
-      getMoves_end();
-      getMoves_whiteCastle();
-      getMoves_blackCastle();
-      getMoves_whiteCastleKingMoved();
-      getMoves_whiteCastleRookMoved();
-
-      getType();
+      runUnit(getMoves_blocked);
+      runUnit(getMoves_capture);
+      runUnit(getMoves_free);
+      runUnit(getMoves_end);
+      runUnit(getMoves_whiteCastle);
+      runUnit(getMoves_blackCastle);
+      runUnit(getMoves_whiteCastleKingMoved);
+      runUnit(getMoves_whiteCastleRookMoved);
+      runUnit(getMoves_whiteCastleThroughCheck);
+      runUnit(getMoves_whiteCastleInCheck);
+
+      runUnit(getType);
 
       report("King");
    }
@@ -46,5 +48,7 @@ private:
    void getMoves_blackCastle();
    void getMoves_whiteCastleKingMoved();
    void getMoves_whiteCastleRookMoved();
+   void getMoves_whiteCastleThroughCheck();
+   void getMoves_whiteCastleInCheck();
    void getType();
 };
@@ -22,12 +22,12 @@ public:
 
    void run()
    {
-      getMoves_blocked();
-      getMoves_capture();
-      getMoves_free();
-      getMoves_end();
+      runUnit(getMoves_blocked);
+      runUnit(getMoves_capture);
+      runUnit(getMoves_free);
+      runUnit(getMoves_end);
 
-      getType();
+      runUnit(getType);
       
       report("Knight");
    }
@@ -0,0 +1,195 @@
+/***********************************************************************
+ * Source File:
+ *    TEST LAZY SMP
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for LazySmp
+ ************************************************************************/
+
+#include "testLazySmp.h"
+#include "lazySmp.h"
+#include "board.h"
+#include <thread>
+#include <atomic>
+using namespace std;
+
+static const char* KIWIPETE = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+
+/*************************************
+ * CONSTRUCT threads
+ * Input : no threads, four, and more than the most
+ * Output: one, four, and the most
+ **************************************/
+void TestLazySmp::construct_threads()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(FEN_INITIAL);
+
+   // EXERCISE
+   LazySmp none(board, nullptr, 0);
+   LazySmp four(board, nullptr, 4);
+   LazySmp many(board, nullptr, 1000);
+
+   // VERIFY
+   assertUnit(none.getThreads() == 1);
+   assertUnit(four.getThreads() == 4);
+   assertUnit(many.getThreads() == LazySmp::MAX_THREADS);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH one thread
+ * Input : a middlegame to depth 4 on one thread, and
+ *         with a plain Search, each with an empty table
+ * Output: exactly the same search
+ **************************************/
+void TestLazySmp::search_oneThread()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(KIWIPETE);
+   TranspositionTable tableSmp(1);
+   TranspositionTable tableSearch(1);
+   LazySmp smp(board, &tableSmp, 1);
+   Search search(board, &tableSearch);
+
+   // EXERCISE
+   int scoreSmp = smp.search(4);
+   int scoreSearch = search.search(4);
+
+   // VERIFY
+   assertUnit(scoreSmp == scoreSearch);
+   assertUnit(smp.getNodes() == search.getNodes());
+   assertUnit(smp.getBestMove().getUCI() == search.getBestMove().getUCI());
+   assertUnit(smp.getDepth() == 4);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH mate in one
+ * Input : a back rank mate on four threads
+ * Output: the mate, and the board as it was
+ **************************************/
+void TestLazySmp::search_mateInOne()
+{
+   // SETUP
+   const char* fen = "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1";
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(fen);
+   TranspositionTable table(1);
+   LazySmp smp(board, &table, 4);
+
+   // EXERCISE
+   int score = smp.search(3);
+
+   // VERIFY
+   assertUnit(score == Search::MATE - 1);
+   assertUnit(smp.hasBestMove());
+   assertUnit(smp.getBestMove().getUCI() == "a1a8");
+   assertUnit(board.getFEN() == fen);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH move time
+ * Input : a middlegame on three threads for 100 ms with
+ *         no depth limit
+ * Output: the helpers stop with the main search, and
+ *         there is a move
+ **************************************/
+void TestLazySmp::search_moveTime()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(KIWIPETE);
+   TranspositionTable table(1);
+   LazySmp smp(board, &table, 3);
+   TimeManager time;
+   time.setMoveTime(100);
+
+   // EXERCISE
+   smp.search(Search::MAX_PLY, time);
+
+   // VERIFY
+   assertUnit(smp.hasBestMove());
+   assertUnit(smp.getDepth() >= 1);
+   assertUnit(smp.getDepth() < Search::MAX_PLY);
+   assertUnit(smp.getNodes() > 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH again
+ * Input : two threads, two searches, a move played between
+ * Output: both reach the depth, the second from the new position
+ **************************************/
+void TestLazySmp::search_again()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(FEN_INITIAL);
+   TranspositionTable table(1);
+   LazySmp smp(board, &table, 2);
+   smp.search(3);
+   assertUnit(smp.getDepth() == 3);
+   board.move(smp.getBestMove());
+
+   // EXERCISE
+   smp.search(3);
+
+   // VERIFY
+   assertUnit(smp.getDepth() == 3);
+   assertUnit(smp.hasBestMove());
+   assertUnit(!board.whiteTurn());
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * STOP other thread
+ * Input : a search with no limit on three threads, started
+ *         on a thread of its own, as the game does, and stopped
+ *         from this one while it starts its helpers and searches
+ * Output: the search finishes short of the limit with a move
+ **************************************/
+void TestLazySmp::stop_otherThread()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(KIWIPETE);
+   TranspositionTable table(1);
+   LazySmp smp(board, &table, 3);
+   atomic<bool> finished(false);
+   thread thinker([&]()
+   {
+      smp.search(Search::MAX_PLY);
+      finished.store(true, memory_order_release);
+   });
+
+   // EXERCISE
+   while (!finished.load(memory_order_acquire))
+   {
+      smp.stop();
+      this_thread::yield();
+   }
+   thinker.join();
+
+   // VERIFY
+   assertUnit(smp.hasBestMove());
+   assertUnit(smp.getDepth() >= 1);
+   assertUnit(smp.getDepth() < Search::MAX_PLY);
+
+   // TEARDOWN
+   board.free();
+}
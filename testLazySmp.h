@@ -0,0 +1,39 @@
+/***********************************************************************
+ * Header File:
+ *    TEST LAZY SMP
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for LazySmp
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * LAZY SMP TEST
+ * Test the LazySmp class
+ ***************************************************/
+class TestLazySmp : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_threads);
+      runUnit(search_oneThread);
+      runUnit(search_mateInOne);
+      runUnit(search_moveTime);
+      runUnit(search_again);
+      runUnit(stop_otherThread);
+
+      report("LazySmp");
+   }
+private:
+   void construct_threads();
+   void search_oneThread();
+   void search_mateInOne();
+   void search_moveTime();
+   void search_again();
+   void stop_otherThread();
+};
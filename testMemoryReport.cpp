@@ -0,0 +1,182 @@
+/***********************************************************************
+ * Source File:
+ *    TEST MEMORY REPORT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for MemoryReport
+ ************************************************************************/
+
+#include "testMemoryReport.h"
+#include "memoryReport.h"
+#include "board.h"
+#include "transpositionTable.h"
+#include <sstream>
+using namespace std;
+
+/*************************************
+ * GET BYTES by subsystem
+ * Input : two board lines and a hash line
+ * Output: the subtotals and the total
+ **************************************/
+void TestMemoryReport::getBytes_bySubsystem()
+{
+   // SETUP
+   MemoryReport report;
+   report.add("Board", "Board", 1, 100);
+   report.add("Board", "Pieces", 32, 320);
+   report.add("Hash", "Table", 4, 64);
+
+   // EXERCISE
+   size_t board = report.getBytes("Board");
+   size_t hash = report.getBytes("Hash");
+   size_t none = report.getBytes("Book");
+   size_t total = report.getBytes();
+
+   // VERIFY
+   assertUnit(board == 420);
+   assertUnit(hash == 64);
+   assertUnit(none == 0);
+   assertUnit(total == 484);
+   assertUnit(report.getItems().size() == 3);
+}
+
+/*************************************
+ * GET HEAP BYTES short
+ * Input : a move's worth of text
+ * Output: none on the heap, it fits in the string
+ **************************************/
+void TestMemoryReport::getHeapBytes_short()
+{
+   // SETUP
+   string text = "e2e4";
+
+   // EXERCISE
+   size_t bytes = MemoryReport::getHeapBytes(text);
+
+   // VERIFY
+   assertUnit(bytes == 0);
+}
+
+/*************************************
+ * GET HEAP BYTES long
+ * Input : 100 characters
+ * Output: at least the 100 and the null
+ **************************************/
+void TestMemoryReport::getHeapBytes_long()
+{
+   // SETUP
+   string text(100, 'x');
+
+   // EXERCISE
+   size_t bytes = MemoryReport::getHeapBytes(text);
+
+   // VERIFY
+   assertUnit(bytes >= 101);
+}
+
+/*************************************
+ * GET HEAP BYTES moves
+ * Input : a list of 3 moves with room for 10
+ * Output: all 10 are counted
+ **************************************/
+void TestMemoryReport::getHeapBytes_moves()
+{
+   // SETUP
+   vector<Move> moves;
+   moves.reserve(10);
+   moves.push_back(Move("e2e4"));
+   moves.push_back(Move("e7e5"));
+   moves.push_back(Move("g1f3"));
+
+   // EXERCISE
+   size_t bytes = MemoryReport::getHeapBytes(moves);
+
+   // VERIFY
+   assertUnit(bytes >= 10 * sizeof(Move));
+}
+
+/*************************************
+ * BOARD initial
+ * Input : the starting position
+ * Output: 32 pieces, 32 spaces, and the board itself
+ **************************************/
+void TestMemoryReport::board_initial()
+{
+   // SETUP
+   Board board;
+   MemoryReport report;
+
+   // EXERCISE
+   board.memoryReport(report);
+
+   // VERIFY
+   size_t pieces = 0;
+   size_t spaces = 0;
+   size_t bytesPieces = 0;
+   for (const MemoryReport::Item& item : report.getItems())
+   {
+      if (item.name == "Pieces")
+      {
+         pieces = item.count;
+         bytesPieces = item.bytes;
+      }
+      if (item.name == "Spaces")
+         spaces = item.count;
+   }
+   assertUnit(pieces == 32);
+   assertUnit(spaces == 32);
+   assertUnit(bytesPieces >= 32 * sizeof(Space));
+   assertUnit(report.getBytes("Board") >= sizeof(Board) + 64 * sizeof(Space));
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * TRANSPOSITION TABLE buckets
+ * Input : a 1 MB transposition table
+ * Output: one line under Hash with every bucket, and
+ *         at least the megabyte they take
+ **************************************/
+void TestMemoryReport::transpositionTable_buckets()
+{
+   // SETUP
+   TranspositionTable table(1);
+   MemoryReport report;
+
+   // EXERCISE
+   table.memoryReport(report);
+
+   // VERIFY
+   assertUnit(report.getItems().size() == 1);
+   assertUnit(report.getItems()[0].subsystem == "Hash");
+   assertUnit(report.getItems()[0].count == table.getNumBuckets());
+   assertUnit(report.getBytes("Hash") >= table.getBytes());
+   assertUnit(table.getBytes() >= 1024 * 1024);
+}  // TEARDOWN
+
+/*************************************
+ * WRITE subtotals
+ * Input : lines in two subsystems
+ * Output: a subtotal for each, then the total
+ **************************************/
+void TestMemoryReport::write_subtotals()
+{
+   // SETUP
+   MemoryReport report;
+   report.add("Board", "Board", 1, 100);
+   report.add("Hash", "Table", 4, 64);
+   ostringstream sout;
+
+   // EXERCISE
+   report.write(sout);
+
+   // VERIFY
+   string text = sout.str();
+   assertUnit(text.find("all of Board") != string::npos);
+   assertUnit(text.find("all of Hash") != string::npos);
+   assertUnit(text.find("all of Board") < text.find("all of Hash"));
+   assertUnit(text.find("Total") != string::npos);
+   assertUnit(text.find("164") != string::npos);
+}
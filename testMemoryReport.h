@@ -0,0 +1,41 @@
+/***********************************************************************
+ * Header File:
+ *    TEST MEMORY REPORT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for MemoryReport
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * MEMORY REPORT TEST
+ * Test the MemoryReport class
+ ***************************************************/
+class TestMemoryReport : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(getBytes_bySubsystem);
+      runUnit(getHeapBytes_short);
+      runUnit(getHeapBytes_long);
+      runUnit(getHeapBytes_moves);
+      runUnit(board_initial);
+      runUnit(transpositionTable_buckets);
+      runUnit(write_subtotals);
+
+      report("MemoryReport");
+   }
+private:
+   void getBytes_bySubsystem();
+   void getHeapBytes_short();
+   void getHeapBytes_long();
+   void getHeapBytes_moves();
+   void board_initial();
+   void transpositionTable_buckets();
+   void write_subtotals();
+};
@@ -0,0 +1,189 @@
+/***********************************************************************
+ * Source File:
+ *    TEST MICRO BENCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for MicroBench
+ ************************************************************************/
+
+#include "testMicroBench.h"
+#include "microBench.h"
+#include <sstream>
+using namespace std;
+
+/*************************************
+ * GET MEAN samples
+ * Input : 1, 2, 3, 4, 10
+ * Output: 4
+ **************************************/
+void TestMicroBench::getMean_samples()
+{
+   // SETUP
+   MicroBench::Result result;
+   result.samples = { 1.0, 2.0, 3.0, 4.0, 10.0 };
+
+   // EXERCISE
+   double mean = result.getMean();
+
+   // VERIFY
+   assertEquals(mean, 4.0);
+}
+
+/*************************************
+ * GET STD DEV samples
+ * Input : 2, 4, 4, 4, 5, 5, 7, 9
+ * Output: sqrt(32 / 7), the sample standard deviation
+ **************************************/
+void TestMicroBench::getStdDev_samples()
+{
+   // SETUP
+   MicroBench::Result result;
+   result.samples = { 2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0 };
+
+   // EXERCISE
+   double stdDev = result.getStdDev();
+
+   // VERIFY
+   assertEquals(stdDev, 2.13809);
+}
+
+/*************************************
+ * GET STD DEV one
+ * Input : a single sample
+ * Output: 0, there is no spread to measure
+ **************************************/
+void TestMicroBench::getStdDev_one()
+{
+   // SETUP
+   MicroBench::Result result;
+   result.samples = { 42.0 };
+
+   // EXERCISE
+   double stdDev = result.getStdDev();
+
+   // VERIFY
+   assertEquals(stdDev, 0.0);
+}
+
+/*************************************
+ * GET PERCENTILE samples
+ * Input : 40, 10, 30, 20, 50 (unsorted)
+ * Output: min 10, median 30, 95th 48 (between 40 and 50), max 50
+ **************************************/
+void TestMicroBench::getPercentile_samples()
+{
+   // SETUP
+   MicroBench::Result result;
+   result.samples = { 40.0, 10.0, 30.0, 20.0, 50.0 };
+
+   // EXERCISE and VERIFY
+   assertEquals(result.getMin(), 10.0);
+   assertEquals(result.getPercentile(0.0), 10.0);
+   assertEquals(result.getMedian(), 30.0);
+   assertEquals(result.getPercentile(95.0), 48.0);
+   assertEquals(result.getPercentile(100.0), 50.0);
+}
+
+/*************************************
+ * RUN repetitions
+ * Input : one case, 3 repetitions of 1 ms
+ * Output: 3 samples, and the body did every iteration it was timed for
+ **************************************/
+void TestMicroBench::run_repetitions()
+{
+   // SETUP
+   MicroBench bench(3 /*repetitions*/, 0.001 /*seconds*/);
+   long long count = 0;
+   bench.add("count", [&count](int n)
+   {
+      for (int i = 0; i < n; i++)
+         MicroBench::consume(count++);
+   });
+   ostringstream sout;
+
+   // EXERCISE
+   vector<MicroBench::Result> results = bench.run(sout);
+
+   // VERIFY
+   assertUnit(results.size() == 1);
+   assertUnit(results[0].name == "count");
+   assertUnit(results[0].samples.size() == 3);
+   assertUnit(results[0].iterations >= 1);
+   assertUnit(count >= 4LL * results[0].iterations); // warm-up plus the three
+   assertUnit(results[0].getMin() >= 0.0);
+   assertUnit(sout.str().find("count") != string::npos);
+}
+
+/*************************************
+ * RUN setup and teardown
+ * Input : a case preparing one object per iteration
+ * Output: every timed body sees what setup prepared, and
+ *         teardown clears it each time
+ **************************************/
+void TestMicroBench::run_setupTeardown()
+{
+   // SETUP
+   MicroBench bench(2 /*repetitions*/, 0.0005 /*seconds*/);
+   vector<int> prepared;
+   bool allPrepared = true;
+   int teardowns = 0;
+   bench.add("prepared",
+      [&](int n) { prepared.assign(n, 1); },
+      [&](int n) { allPrepared = allPrepared && (int)prepared.size() == n; },
+      [&](int)   { prepared.clear(); teardowns++; },
+      1000);
+   ostringstream sout;
+
+   // EXERCISE
+   bench.run(sout);
+
+   // VERIFY
+   assertUnit(allPrepared);
+   assertUnit(prepared.empty());
+   assertUnit(teardowns >= 3);
+}
+
+/*************************************
+ * RUN max iterations
+ * Input : a case capped at 8 iterations that never fills a repetition
+ * Output: 8 iterations per repetition
+ **************************************/
+void TestMicroBench::run_maxIterations()
+{
+   // SETUP
+   MicroBench bench(2 /*repetitions*/, 10.0 /*seconds*/);
+   bench.add("capped", nullptr, [](int) {}, nullptr, 8);
+   ostringstream sout;
+
+   // EXERCISE
+   vector<MicroBench::Result> results = bench.run(sout);
+
+   // VERIFY
+   assertUnit(results.size() == 1);
+   assertUnit(results[0].iterations == 8);
+}
+
+/*************************************
+ * RUN filter
+ * Input : cases "Board::move" and "Move::read", filter "Board"
+ * Output: only the first is run
+ **************************************/
+void TestMicroBench::run_filter()
+{
+   // SETUP
+   MicroBench bench(1 /*repetitions*/, 0.0001 /*seconds*/);
+   bool ranMove = false;
+   bool ranRead = false;
+   bench.add("Board::move", [&](int) { ranMove = true; });
+   bench.add("Move::read",  [&](int) { ranRead = true; });
+   ostringstream sout;
+
+   // EXERCISE
+   vector<MicroBench::Result> results = bench.run(sout, "Board");
+
+   // VERIFY
+   assertUnit(results.size() == 1);
+   assertUnit(ranMove);
+   assertUnit(!ranRead);
+}
@@ -0,0 +1,43 @@
+/***********************************************************************
+ * Header File:
+ *    TEST MICRO BENCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for MicroBench
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * MICRO BENCH TEST
+ * Test the MicroBench class
+ ***************************************************/
+class TestMicroBench : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(getMean_samples);
+      runUnit(getStdDev_samples);
+      runUnit(getStdDev_one);
+      runUnit(getPercentile_samples);
+      runUnit(run_repetitions);
+      runUnit(run_setupTeardown);
+      runUnit(run_maxIterations);
+      runUnit(run_filter);
+
+      report("MicroBench");
+   }
+private:
+   void getMean_samples();
+   void getStdDev_samples();
+   void getStdDev_one();
+   void getPercentile_samples();
+   void run_repetitions();
+   void run_setupTeardown();
+   void run_maxIterations();
+   void run_filter();
+};
@@ -21,43 +21,43 @@ public:
    void run()
    {
       // Ticket 4: Move Core
-      constructor_default();
-      letterFromPieceType_space();
-      letterFromPieceType_pawn();
-      letterFromPieceType_bishop();
-      letterFromPieceType_knight();
-      letterFromPieceType_rook();
-      letterFromPieceType_queen();
-      letterFromPieceType_king();
-      pieceTypeFromLetter_pawn();
-      pieceTypeFromLetter_knight();
-      pieceTypeFromLetter_bishop();
-      pieceTypeFromLetter_rook();
-      pieceTypeFromLetter_king();
-      pieceTypeFromLetter_queen();
-      equal_not();
-      equal_equals();
-      lessthan_lessthan();
-      lessthan_equals();
-      lessthan_greaterthan();
+      runUnit(constructor_default);
+      runUnit(letterFromPieceType_space);
+      runUnit(letterFromPieceType_pawn);
+      runUnit(letterFromPieceType_bishop);
+      runUnit(letterFromPieceType_knight);
+      runUnit(letterFromPieceType_rook);
+      runUnit(letterFromPieceType_queen);
+      runUnit(letterFromPieceType_king);
+      runUnit(pieceTypeFromLetter_pawn);
+      runUnit(pieceTypeFromLetter_knight);
+      runUnit(pieceTypeFromLetter_bishop);
+      runUnit(pieceTypeFromLetter_rook);
+      runUnit(pieceTypeFromLetter_king);
+      runUnit(pieceTypeFromLetter_queen);
+      runUnit(equal_not);
+      runUnit(equal_equals);
+      runUnit(lessthan_lessthan);
+      runUnit(lessthan_equals);
+      runUnit(lessthan_greaterthan);
 
       // Ticket 5: Move Text
-      read_simple();
-      read_capture();
-      read_enpassant();
-      read_castleKing();
-      read_castleQueen();
-      constructString_simple();
-      assign_simple();
-      assign_capture();
-      assign_enpassant();
-      assign_castleKing();
-      assign_castleQueen();
-      getText_simple();
-      getText_capture();
-      getText_enpassant();
-      getText_castleKing();
-      getText_castleQueen();
+      runUnit(read_simple);
+      runUnit(read_capture);
+      runUnit(read_enpassant);
+      runUnit(read_castleKing);
+      runUnit(read_castleQueen);
+      runUnit(constructString_simple);
+      runUnit(assign_simple);
+      runUnit(assign_capture);
+      runUnit(assign_enpassant);
+      runUnit(assign_castleKing);
+      runUnit(assign_castleQueen);
+      runUnit(getText_simple);
+      runUnit(getText_capture);
+      runUnit(getText_enpassant);
+      runUnit(getText_castleKing);
+      runUnit(getText_castleQueen);
 
       report("Move");
    }
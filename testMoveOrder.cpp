@@ -0,0 +1,284 @@
+/***********************************************************************
+ * Source File:
+ *    TEST MOVE ORDER
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for MoveOrder
+ ************************************************************************/
+
+#include "testMoveOrder.h"
+#include "moveOrder.h"
+#include "transpositionTable.h"
+#include "board.h"
+using namespace std;
+
+/*************************************
+ * FIND
+ * The move of the list with this UCI text
+ **************************************/
+static size_t find(const vector<Move>& list, const string& uci)
+{
+   for (size_t i = 0; i < list.size(); i++)
+      if (list[i].getUCI() == uci)
+         return i;
+   return list.size();
+}
+
+/*************************************
+ * MVV LVA victim then attacker
+ * Input : a pawn and a knight that can take the queen, and
+ *         the pawn that can take a pawn instead
+ * +---a-b-c-d-e-f-g-h---+
+ * 8           k         8
+ * 5         q   p       5
+ * 4           P         4
+ * 3       N             3
+ * 1       Q   K         1
+ * +---a-b-c-d-e-f-g-h---+
+ * Output: pawn takes queen, then knight takes queen, then
+ *         pawn takes pawn
+ **************************************/
+void TestMoveOrder::mvvLva_victimThenAttacker()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4k3/8/8/3q1p2/4P3/2N5/8/2Q1K3 w - - 0 1");
+   vector<Move> list;
+   board.generateCaptures(list);
+   size_t pawnTakesQueen = find(list, "e4d5");
+   size_t knightTakesQueen = find(list, "c3d5");
+   size_t pawnTakesPawn = find(list, "e4f5");
+   assertUnit(pawnTakesQueen < list.size());
+   assertUnit(knightTakesQueen < list.size());
+   assertUnit(pawnTakesPawn < list.size());
+
+   // EXERCISE
+   int scorePawnTakesQueen = MoveOrder::mvvLva(board, list[pawnTakesQueen]);
+   int scoreKnightTakesQueen = MoveOrder::mvvLva(board, list[knightTakesQueen]);
+   int scorePawnTakesPawn = MoveOrder::mvvLva(board, list[pawnTakesPawn]);
+
+   // VERIFY
+   assertUnit(scorePawnTakesQueen > scoreKnightTakesQueen);
+   assertUnit(scoreKnightTakesQueen > scorePawnTakesPawn);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SCORE bands
+ * Input : the initial position after 1. e4, with a PV move, a
+ *         hash move, two killers, and a counter to e4
+ * Output: each in its band, the killers over the counter, and
+ *         the other quiet moves below them all
+ **************************************/
+void TestMoveOrder::score_bands()
+{
+   // SETUP
+   Board board;
+   vector<Move> list;
+   board.generateMoves(list);
+   board.makeMove(list[find(list, "e2e4")]);
+   board.generateMoves(list);
+   MoveOrder order(8);
+   order.killers[2 * 2] = TranspositionTable::pack(list[find(list, "g8f6")]);
+   order.killers[2 * 2 + 1] = TranspositionTable::pack(list[find(list, "b8c6")]);
+   order.counters[MoveOrder::previous(board)] = TranspositionTable::pack(list[find(list, "c7c5")]);
+   Move pv = list[find(list, "e7e5")];
+   uint16_t hashMove = TranspositionTable::pack(list[find(list, "d7d5")]);
+   vector<int> scores;
+
+   // EXERCISE
+   bool foundPV = order.score(board, list, scores, 2, &pv, hashMove);
+
+   // VERIFY
+   assertUnit(foundPV);
+   assertUnit(scores.size() == list.size());
+   assertUnit(scores[find(list, "e7e5")] == MoveOrder::PV);
+   assertUnit(scores[find(list, "d7d5")] == MoveOrder::HASH);
+   assertUnit(scores[find(list, "g8f6")] == MoveOrder::KILLER + 1);
+   assertUnit(scores[find(list, "b8c6")] == MoveOrder::KILLER);
+   assertUnit(scores[find(list, "c7c5")] == MoveOrder::COUNTER);
+   assertUnit(scores[find(list, "a7a6")] == 0);
+
+   // TEARDOWN
+   board.undoMove();
+   board.free();
+}
+
+/*************************************
+ * PICK best
+ * Input : three moves scored 3, 9, and 1
+ * Output: the one scored 9 comes to the front, then the 3
+ **************************************/
+void TestMoveOrder::pick_best()
+{
+   // SETUP
+   vector<Move> list = { Move("a2a3"), Move("b2b3"), Move("c2c3") };
+   vector<int> scores = { 3, 9, 1 };
+
+   // EXERCISE
+   MoveOrder::pick(list, scores, 0);
+   MoveOrder::pick(list, scores, 1);
+
+   // VERIFY
+   assertUnit(list[0].getUCI() == "b2b3");
+   assertUnit(list[1].getUCI() == "a2a3");
+   assertUnit(list[2].getUCI() == "c2c3");
+   assertUnit(scores[0] == 9);
+   assertUnit(scores[1] == 3);
+   assertUnit(scores[2] == 1);
+}
+
+/*************************************
+ * UPDATE killers
+ * Input : two quiet cutoffs at ply 3, then the first again
+ * Output: the newer killer first, with no duplicates
+ **************************************/
+void TestMoveOrder::update_killers()
+{
+   // SETUP
+   Board board;
+   vector<Move> list;
+   board.generateMoves(list);
+   MoveOrder order(8);
+   uint16_t e4 = TranspositionTable::pack(list[find(list, "e2e4")]);
+   uint16_t d4 = TranspositionTable::pack(list[find(list, "d2d4")]);
+
+   // EXERCISE
+   order.update(board, list, find(list, "e2e4"), 3, 4);
+   order.update(board, list, find(list, "d2d4"), 3, 4);
+   order.update(board, list, find(list, "d2d4"), 3, 4);
+
+   // VERIFY
+   assertUnit(order.getKiller(3, 0) == d4);
+   assertUnit(order.getKiller(3, 1) == e4);
+   assertUnit(order.getKiller(2, 0) == 0);
+   assertUnit(order.getKiller(4, 0) == 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * UPDATE capture
+ * Input : a cutoff by a capture
+ * Output: nothing learned: captures are ordered by what they take
+ **************************************/
+void TestMoveOrder::update_capture()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4k3/8/8/3q4/4P3/8/8/4K3 w - - 0 1");
+   vector<Move> list;
+   board.generateMoves(list);
+   MoveOrder order(8);
+   size_t capture = find(list, "e4d5");
+
+   // EXERCISE
+   order.update(board, list, capture, 1, 6);
+
+   // VERIFY
+   assertUnit(order.getKiller(1, 0) == 0);
+   assertUnit(order.getHistory(true, list[capture]) == 0);
+   for (size_t i = 0; i < list.size(); i++)
+      assertUnit(order.getHistory(true, list[i]) == 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * UPDATE history
+ * Input : the same quiet cutoff many times, after two quiet
+ *         moves were tried
+ * Output: the cutoff move gains but never passes HISTORY_MAX,
+ *         the moves tried before it lose, and black's table
+ *         is untouched
+ **************************************/
+void TestMoveOrder::update_history()
+{
+   // SETUP
+   Board board;
+   vector<Move> list;
+   board.generateMoves(list);
+   MoveOrder order(8);
+   size_t iBest = 2;
+
+   // EXERCISE
+   order.update(board, list, iBest, 0, 4);
+   int first = order.getHistory(true, list[iBest]);
+   for (int i = 0; i < 1000; i++)
+      order.update(board, list, iBest, 0, 10);
+
+   // VERIFY
+   assertUnit(first > 0);
+   assertUnit(order.getHistory(true, list[iBest]) > first);
+   assertUnit(order.getHistory(true, list[iBest]) <= MoveOrder::HISTORY_MAX);
+   assertUnit(order.getHistory(true, list[0]) < 0);
+   assertUnit(order.getHistory(true, list[1]) >= -MoveOrder::HISTORY_MAX);
+   assertUnit(order.getHistory(true, list[3]) == 0);
+   assertUnit(order.getHistory(false, list[iBest]) == 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * UPDATE counter
+ * Input : after 1. e4, a quiet cutoff by Nf6
+ * Output: Nf6 is the counter to e4, and to nothing else
+ **************************************/
+void TestMoveOrder::update_counter()
+{
+   // SETUP
+   Board board;
+   vector<Move> list;
+   board.generateMoves(list);
+   MoveOrder order(8);
+   assertUnit(order.getCounter(board) == 0);
+   board.makeMove(list[find(list, "e2e4")]);
+   board.generateMoves(list);
+
+   // EXERCISE
+   order.update(board, list, find(list, "g8f6"), 1, 3);
+
+   // VERIFY
+   assertUnit(order.getCounter(board) == TranspositionTable::pack(list[find(list, "g8f6")]));
+   board.undoMove();
+   board.generateMoves(list);
+   board.makeMove(list[find(list, "d2d4")]);
+   assertUnit(order.getCounter(board) == 0);
+
+   // TEARDOWN
+   board.undoMove();
+   board.free();
+}
+
+/*************************************
+ * NEW SEARCH forgets
+ * Input : a killer and some history, then a new search
+ * Output: no killer, and the history halved
+ **************************************/
+void TestMoveOrder::newSearch_forgets()
+{
+   // SETUP
+   Board board;
+   vector<Move> list;
+   board.generateMoves(list);
+   MoveOrder order(8);
+   order.update(board, list, 0, 2, 8);
+   int before = order.getHistory(true, list[0]);
+   assertUnit(order.getKiller(2, 0) != 0);
+
+   // EXERCISE
+   order.newSearch();
+
+   // VERIFY
+   assertUnit(order.getKiller(2, 0) == 0);
+   assertUnit(order.getHistory(true, list[0]) == before / 2);
+
+   // TEARDOWN
+   board.free();
+}
@@ -0,0 +1,43 @@
+/***********************************************************************
+ * Header File:
+ *    TEST MOVE ORDER
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for MoveOrder
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * MOVE ORDER TEST
+ * Test the MoveOrder class
+ ***************************************************/
+class TestMoveOrder : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(mvvLva_victimThenAttacker);
+      runUnit(score_bands);
+      runUnit(pick_best);
+      runUnit(update_killers);
+      runUnit(update_capture);
+      runUnit(update_history);
+      runUnit(update_counter);
+      runUnit(newSearch_forgets);
+
+      report("MoveOrder");
+   }
+private:
+   void mvvLva_victimThenAttacker();
+   void score_bands();
+   void pick_best();
+   void update_killers();
+   void update_capture();
+   void update_history();
+   void update_counter();
+   void newSearch_forgets();
+};
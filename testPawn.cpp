@@ -397,6 +397,50 @@ void TestPawn::getMoves_enpassantBlack()
    board.board[5][2] = board.board[6][3] = nullptr;
 }
 
+/*************************************
+ * GET MOVES TEST Enpassant wrong rank
+ * Enpassant: white b4 is beside a pawn that just moved, but that
+ *            pawn took a single step so there is no en passant
+ *
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7                     7
+ * 6                     6
+ * 5     P               5
+ * 4   P(p)              4
+ * 3                     3
+ * 2                     2
+ * 1                     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ **************************************/
+void TestPawn::getMoves_enpassantWrongRank()
+{
+   // SETUP
+   BoardEmpty board;
+   board.moveNumber = 1;
+   Pawn pawn(7, 7, false /*white*/); // we will reset all this.
+   pawn.fWhite = true;
+   pawn.nMoves = 99;
+   pawn.position.colRow = 0x13;      // col 1 row 3 = b4
+   board.board[1][3] = &pawn;        // white pawn going up
+   Black black(PAWN);
+   black.nMoves = 1;
+   black.lastMove = 0;
+   board.board[0][3] = board.board[1][4] = &black;
+   set <Move> moves;
+
+   // EXERCISE
+   pawn.getMoves(moves, board);
+
+   // VERIFY
+   assertUnit(moves.size() == 0);
+
+   // TEARDOWN
+   board.board[1][3] = board.board[0][3] = board.board[1][4] = nullptr;
+}
+
 /*************************************
  * GET MOVES TEST Promotion
  * Promotion: white pawn b7 can capture two pawns: a8 and c8.
@@ -440,7 +484,7 @@ void TestPawn::getMoves_promotionWhite()
    pawn.getMoves(moves, board);
 
    // VERIFY
-   assertUnit(moves.size() == 3);
+   assertUnit(moves.size() == 12);
    assertUnit(moves.find(b7a8p) != moves.end());
    assertUnit(moves.find(b7b8) != moves.end());
    assertUnit(moves.find(b7c8p) != moves.end());
@@ -493,7 +537,7 @@ void TestPawn::getMoves_promotionBlack()
    pawn.getMoves(moves, board);
 
    // VERIFY
-   assertUnit(moves.size() == 3);  // many possible moves
+   assertUnit(moves.size() == 12);  // many possible moves
    assertUnit(moves.find(e2d1p) != moves.end());
    assertUnit(moves.find(e2e1) != moves.end());
    assertUnit(moves.find(e2f1p) != moves.end());
@@ -503,6 +547,100 @@ void TestPawn::getMoves_promotionBlack()
 }
 
 
+/*************************************
+ * GET MOVES TEST Underpromotion
+ * Promotion: white pawn g7 moves into g8 and may become a queen,
+ *            rook, bishop, or knight: four moves
+ *
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                 .   8
+ * 7                (p)  7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1                     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ **************************************/
+void TestPawn::getMoves_underpromotionWhite()
+{
+   // SETUP
+   BoardEmpty board;
+   Pawn pawn(7, 7, false /*white*/); // we will reset all this.
+   pawn.fWhite = true;
+   pawn.nMoves = 99;
+   pawn.position.colRow = 0x66;      // col 6 row 6 = g7
+   board.board[6][6] = &pawn;
+   set <Move> moves;
+   Move g7g8;
+   g7g8.source.colRow = 0x66;
+   g7g8.dest.colRow = 0x67;
+
+   // EXERCISE
+   pawn.getMoves(moves, board);
+
+   // VERIFY
+   assertUnit(moves.size() == 4);
+   for (PieceType pt : { QUEEN, ROOK, BISHOP, KNIGHT })
+   {
+      g7g8.promote = pt;
+      assertUnit(moves.find(g7g8) != moves.end());
+   }
+
+   // TEARDOWN
+   board.board[6][6] = nullptr;
+}
+
+/*************************************
+ * GET MOVES TEST Underpromotion
+ * Promotion: black pawn b2 moves into b1 and may become a queen,
+ *            rook, bishop, or knight: four moves
+ *
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7                     7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2    (P)              2
+ * 1     .               1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ **************************************/
+void TestPawn::getMoves_underpromotionBlack()
+{
+   // SETUP
+   BoardEmpty board;
+   Pawn pawn(7, 7, false /*white*/); // we will reset all this.
+   pawn.fWhite = false;
+   pawn.nMoves = 99;
+   pawn.position.colRow = 0x11;      // col 1 row 1 = b2
+   board.board[1][1] = &pawn;
+   set <Move> moves;
+   Move b2b1;
+   b2b1.source.colRow = 0x11;
+   b2b1.dest.colRow = 0x10;
+
+   // EXERCISE
+   pawn.getMoves(moves, board);
+
+   // VERIFY
+   assertUnit(moves.size() == 4);
+   for (PieceType pt : { QUEEN, ROOK, BISHOP, KNIGHT })
+   {
+      b2b1.promote = pt;
+      assertUnit(moves.find(b2b1) != moves.end());
+   }
+
+   // TEARDOWN
+   board.board[1][1] = nullptr;
+}
+
 /*************************************
  * GET TYPE : pawn
  * Input:
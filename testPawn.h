@@ -21,18 +21,21 @@ public:
 
    void run()
    {
-      getMoves_simpleWhite();
-      getMoves_simpleBlack();
-      getMoves_initialAdvanceWhite();
-      getMoves_initialAdvanceBlack();
-      getMoves_captureWhite();
-      getMoves_captureBlack();
-      getMoves_enpassantWhite();
-      getMoves_enpassantBlack();
-      getMoves_promotionWhite();
-      getMoves_promotionBlack();
-
-      getType();
+      runUnit(getMoves_simpleWhite);
+      runUnit(getMoves_simpleBlack);
+      runUnit(getMoves_initialAdvanceWhite);
+      runUnit(getMoves_initialAdvanceBlack);
+      runUnit(getMoves_captureWhite);
+      runUnit(getMoves_captureBlack);
+      runUnit(getMoves_enpassantWhite);
+      runUnit(getMoves_enpassantBlack);
+      runUnit(getMoves_enpassantWrongRank);
+      runUnit(getMoves_promotionWhite);
+      runUnit(getMoves_promotionBlack);
+      runUnit(getMoves_underpromotionWhite);
+      runUnit(getMoves_underpromotionBlack);
+
+      runUnit(getType);
 
       report("Pawn");
    }
@@ -45,8 +48,11 @@ private:
    void getMoves_captureBlack();
    void getMoves_enpassantWhite();
    void getMoves_enpassantBlack();
+   void getMoves_enpassantWrongRank();
    void getMoves_promotionWhite();
    void getMoves_promotionBlack();
+   void getMoves_underpromotionWhite();
+   void getMoves_underpromotionBlack();
    void getType();
 
 };
@@ -0,0 +1,176 @@
+/***********************************************************************
+ * Source File:
+ *    TEST PERF COUNTERS
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for PerfCounters. The hardware may not be there
+ *    (a virtual machine, another operating system), so these check
+ *    that whatever is available is sensible and the rest is reported
+ *    as such
+ ************************************************************************/
+
+#include "testPerfCounters.h"
+#include "perfCounters.h"
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// work for the counters to count
+static volatile double sink = 0.0;
+static void work()
+{
+   for (int i = 0; i < 100000; i++)
+      sink = sink + i * 0.5;
+}
+
+/*************************************
+ * CONSTRUCT zero
+ * Input : counters that have not been started
+ * Output: every count is zero
+ **************************************/
+void TestPerfCounters::construct_zero()
+{
+   // EXERCISE
+   PerfCounters counters;
+
+   // VERIFY
+   for (int i = 0; i < PerfCounters::NUM_EVENTS; i++)
+      assertUnit(counters.get((PerfCounters::Event)i) == 0);
+}
+
+/*************************************
+ * GET NAME all
+ * Input : each event
+ * Output: a name for each
+ **************************************/
+void TestPerfCounters::getName_all()
+{
+   // EXERCISE and VERIFY
+   assertUnit(string(PerfCounters::getName(PerfCounters::CYCLES)) == "Cycles");
+   assertUnit(string(PerfCounters::getName(PerfCounters::INSTRUCTIONS)) == "Instructions");
+   assertUnit(string(PerfCounters::getName(PerfCounters::L1D_MISSES)) == "L1D misses");
+   assertUnit(string(PerfCounters::getName(PerfCounters::LLC_MISSES)) == "LLC misses");
+   assertUnit(string(PerfCounters::getName(PerfCounters::BRANCH_MISSES)) == "Branch misses");
+}
+
+/*************************************
+ * START STOP counts
+ * Input : a loop of 100,000 iterations
+ * Output: cycles and instructions, where available, are
+ *         well above zero; unavailable events stay zero
+ **************************************/
+void TestPerfCounters::startStop_counts()
+{
+   // SETUP
+   PerfCounters counters;
+
+   // EXERCISE
+   counters.start();
+   work();
+   counters.stop();
+
+   // VERIFY
+   if (counters.isAvailable(PerfCounters::CYCLES))
+      assertUnit(counters.get(PerfCounters::CYCLES) > 100000);
+   if (counters.isAvailable(PerfCounters::INSTRUCTIONS))
+      assertUnit(counters.get(PerfCounters::INSTRUCTIONS) > 100000);
+   for (int i = 0; i < PerfCounters::NUM_EVENTS; i++)
+      if (!counters.isAvailable((PerfCounters::Event)i))
+         assertUnit(counters.get((PerfCounters::Event)i) == 0);
+}
+
+/*************************************
+ * GET IPC range
+ * Input : a loop of 100,000 iterations
+ * Output: 0 when not available, otherwise between 0 and 10
+ **************************************/
+void TestPerfCounters::getIPC_range()
+{
+   // SETUP
+   PerfCounters counters;
+
+   // EXERCISE
+   counters.start();
+   work();
+   counters.stop();
+   double ipc = counters.getIPC();
+
+   // VERIFY
+   if (counters.isAvailable(PerfCounters::CYCLES) && counters.isAvailable(PerfCounters::INSTRUCTIONS))
+      assertUnit(ipc > 0.0 && ipc < 10.0);
+   else
+      assertUnit(ipc == 0.0);
+}
+
+/*************************************
+ * REPORT every event
+ * Input : counters after some work, per 1000 nodes
+ * Output: a line for each event and the IPC, "n/a" for
+ *         each that is unavailable
+ **************************************/
+void TestPerfCounters::report_everyEvent()
+{
+   // SETUP
+   PerfCounters counters;
+   counters.start();
+   work();
+   counters.stop();
+   ostringstream sout;
+
+   // EXERCISE
+   counters.report(sout, 1000, "node");
+
+   // VERIFY
+   string text = sout.str();
+   int lines = 0;
+   int na = 0;
+   for (size_t i = text.find('\n'); i != string::npos; i = text.find('\n', i + 1))
+      lines++;
+   for (size_t i = text.find("n/a"); i != string::npos; i = text.find("n/a", i + 1))
+      na++;
+   int unavailable = 0;
+   for (int i = 0; i < PerfCounters::NUM_EVENTS; i++)
+      unavailable += counters.isAvailable((PerfCounters::Event)i) ? 0 : 1;
+   bool ipc = counters.isAvailable(PerfCounters::CYCLES) &&
+              counters.isAvailable(PerfCounters::INSTRUCTIONS);
+
+   assertUnit(lines == PerfCounters::NUM_EVENTS + 1);
+   assertUnit(na == unavailable + (ipc ? 0 : 1));
+   assertUnit(text.find("Cycles:") == 0);
+   assertUnit(text.find("IPC:") != string::npos);
+}
+
+/*************************************
+ * REPORT aligned
+ * Input : counters after some work
+ * Output: every value, "Branch misses" and "IPC" included,
+ *         starts in the same column
+ **************************************/
+void TestPerfCounters::report_aligned()
+{
+   // SETUP
+   PerfCounters counters;
+   counters.start();
+   work();
+   counters.stop();
+   ostringstream sout;
+
+   // EXERCISE
+   counters.report(sout, 1000, "node");
+
+   // VERIFY
+   istringstream sin(sout.str());
+   string line;
+   vector<size_t> columns;
+   while (getline(sin, line))
+   {
+      size_t colon = line.find(':');
+      assertUnit(colon != string::npos);
+      columns.push_back(line.find_first_not_of(' ', colon + 1));
+   }
+   assertUnit(columns.size() == PerfCounters::NUM_EVENTS + 1);
+   for (size_t column : columns)
+      assertUnit(column == columns[0]);
+}  // TEARDOWN
@@ -0,0 +1,42 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PERF COUNTERS
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for PerfCounters. The hardware may not be there
+ *    (a virtual machine, another operating system), so these check
+ *    that whatever is available is sensible and the rest is reported
+ *    as such
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * PERF COUNTERS TEST
+ * Test the PerfCounters class
+ ***************************************************/
+class TestPerfCounters : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_zero);
+      runUnit(getName_all);
+      runUnit(startStop_counts);
+      runUnit(getIPC_range);
+      runUnit(report_everyEvent);
+      runUnit(report_aligned);
+
+      report("PerfCounters");
+   }
+private:
+   void construct_zero();
+   void getName_all();
+   void startStop_counts();
+   void getIPC_range();
+   void report_everyEvent();
+   void report_aligned();
+};
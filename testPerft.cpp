@@ -0,0 +1,287 @@
+/***********************************************************************
+ * Source File:
+ *    TEST PERFT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for Perft
+ ************************************************************************/
+
+#include "testPerft.h"
+#include "perft.h"
+#include "board.h"
+#include "perftTable.h"
+#include <sstream>
+using namespace std;
+
+/*************************************
+ * COUNT zero
+ * Input : initial position, depth 0
+ * Output: 1, the position itself
+ **************************************/
+void TestPerft::count_zero()
+{
+   // SETUP
+   Board board;
+   Perft perft(board);
+
+   // EXERCISE
+   uint64_t nodes = perft.count(0);
+
+   // VERIFY
+   assertUnit(nodes == 1);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT initial 1
+ * Input : initial position, depth 1
+ * Output: 20 = 16 pawn moves + 4 knight moves
+ **************************************/
+void TestPerft::count_initial1()
+{
+   // SETUP
+   Board board;
+   Perft perft(board);
+
+   // EXERCISE
+   uint64_t nodes = perft.count(1);
+
+   // VERIFY
+   assertUnit(nodes == 20);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT initial 2
+ * Input : initial position, depth 2
+ * Output: 400
+ **************************************/
+void TestPerft::count_initial2()
+{
+   // SETUP
+   Board board;
+   Perft perft(board);
+
+   // EXERCISE
+   uint64_t nodes = perft.count(2);
+
+   // VERIFY
+   assertUnit(nodes == 400);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT initial 3
+ * Input : initial position, depth 3
+ * Output: 8902, the first depth with captures and checks
+ **************************************/
+void TestPerft::count_initial3()
+{
+   // SETUP
+   Board board;
+   Perft perft(board);
+
+   // EXERCISE
+   uint64_t nodes = perft.count(3);
+
+   // VERIFY
+   assertUnit(nodes == 8902);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT restores the board
+ * Input : initial position, depth 3
+ * Output: the same FEN and move number afterwards
+ **************************************/
+void TestPerft::count_restoresBoard()
+{
+   // SETUP
+   Board board;
+   Perft perft(board);
+
+   // EXERCISE
+   perft.count(3);
+
+   // VERIFY
+   assertUnit(board.getFEN() == FEN_INITIAL);
+   assertUnit(board.getCurrentMove() == 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT no bulk
+ * Input : initial position, depth 3, every leaf made
+ * Output: 8902, the same as bulk counting
+ **************************************/
+void TestPerft::count_noBulk()
+{
+   // SETUP
+   Board board;
+   Perft perft(board, false /*bulk*/, false /*fast*/);
+
+   // EXERCISE
+   uint64_t nodes = perft.count(3);
+
+   // VERIFY
+   assertUnit(nodes == 8902);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT fast
+ * Input : a middlegame with castling, depth 3, leaves from countMoves()
+ * Output: the same as counting the move lists
+ **************************************/
+void TestPerft::count_fast()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   Perft perftBulk(board, true /*bulk*/, false /*fast*/);
+   Perft perftFast(board, true /*bulk*/, true /*fast*/);
+
+   // EXERCISE
+   uint64_t nodesBulk = perftBulk.count(3);
+   uint64_t nodesFast = perftFast.count(3);
+
+   // VERIFY
+   assertUnit(nodesFast == nodesBulk);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * DIVIDE initial
+ * Input : initial position, depth 2
+ * Output: 20 root moves of 20 each, 400 total
+ **************************************/
+void TestPerft::divide_initial()
+{
+   // SETUP
+   Board board;
+   Perft perft(board);
+   ostringstream sout;
+
+   // EXERCISE
+   uint64_t nodes = perft.divide(2, sout);
+
+   // VERIFY
+   assertUnit(nodes == 400);
+   assertUnit(sout.str().find("e2e4: 20\n") != string::npos);
+   assertUnit(sout.str().find("g1f3: 20\n") != string::npos);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT PARALLEL initial
+ * Input : initial position, depth 3, 4 threads split 1 ply down
+ * Output: 8902, the same as one thread
+ **************************************/
+void TestPerft::countParallel_initial()
+{
+   // SETUP
+   Board board;
+   Perft perft(board);
+
+   // EXERCISE
+   uint64_t nodes = perft.countParallel(3, 4 /*threads*/, 1 /*split*/);
+
+   // VERIFY
+   assertUnit(nodes == 8902);
+   assertUnit(board.getFEN() == FEN_INITIAL);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * DIVIDE PARALLEL kiwipete
+ * Input : a middlegame, depth 3, 3 threads split 2 plies down
+ * Output: the same divide as one thread, move for move
+ **************************************/
+void TestPerft::divideParallel_kiwipete()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   Perft perft(board);
+   ostringstream soutSerial;
+   ostringstream soutParallel;
+
+   // EXERCISE
+   uint64_t nodesSerial = perft.divide(3, soutSerial);
+   uint64_t nodesParallel = perft.divideParallel(3, 3 /*threads*/, 2 /*split*/, soutParallel);
+
+   // VERIFY
+   assertUnit(nodesParallel == nodesSerial);
+   assertUnit(soutParallel.str() == soutSerial.str());
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT hash
+ * Input : a middlegame, depth 3, with and then without a table
+ * Output: the same count twice, also when the table is already full
+ **************************************/
+void TestPerft::count_hash()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   PerftTable table(1);
+   Perft perft(board);
+   Perft perftHash(board, true /*bulk*/, false /*fast*/, &table);
+
+   // EXERCISE
+   uint64_t nodes = perft.count(3);
+   uint64_t nodesHash = perftHash.count(3);
+   uint64_t nodesHashAgain = perftHash.count(3);
+
+   // VERIFY
+   assertUnit(nodesHash == nodes);
+   assertUnit(nodesHashAgain == nodes);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * COUNT PARALLEL hash
+ * Input : initial position, depth 4, 4 threads sharing a table
+ * Output: 197281
+ **************************************/
+void TestPerft::countParallel_hash()
+{
+   // SETUP
+   Board board;
+   PerftTable table(1);
+   Perft perft(board, true /*bulk*/, true /*fast*/, &table);
+
+   // EXERCISE
+   uint64_t nodes = perft.countParallel(4, 4 /*threads*/, 1 /*split*/);
+
+   // VERIFY
+   assertUnit(nodes == 197281);
+
+   // TEARDOWN
+   board.free();
+}
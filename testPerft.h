@@ -0,0 +1,51 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PERFT
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for Perft
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * PERFT TEST
+ * Test the Perft class
+ ***************************************************/
+class TestPerft : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(count_zero);
+      runUnit(count_initial1);
+      runUnit(count_initial2);
+      runUnit(count_initial3);
+      runUnit(count_restoresBoard);
+      runUnit(count_noBulk);
+      runUnit(count_fast);
+      runUnit(divide_initial);
+      runUnit(countParallel_initial);
+      runUnit(divideParallel_kiwipete);
+      runUnit(count_hash);
+      runUnit(countParallel_hash);
+
+      report("Perft");
+   }
+private:
+   void count_zero();
+   void count_initial1();
+   void count_initial2();
+   void count_initial3();
+   void count_restoresBoard();
+   void count_noBulk();
+   void count_fast();
+   void divide_initial();
+   void countParallel_initial();
+   void divideParallel_kiwipete();
+   void count_hash();
+   void countParallel_hash();
+};
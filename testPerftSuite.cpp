@@ -0,0 +1,103 @@
+/***********************************************************************
+ * Source File:
+ *    TEST PERFT SUITE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for PerftSuite
+ ************************************************************************/
+
+#include "testPerftSuite.h"
+#include "perftSuite.h"
+#include <sstream>
+using namespace std;
+
+/*************************************
+ * RUN depth within max nodes
+ * Input : the initial position, at most 9000 nodes
+ * Output: depth 3, whose 8902 nodes fit where 197281 do not
+ **************************************/
+void TestPerftSuite::run_depthWithinMaxNodes()
+{
+   // SETUP
+   PerftSuite suite;
+   suite.setMaxNodes(9000);
+   const PerftSuite::Case& initial = PerftSuite::getCases()[0];
+
+   // EXERCISE
+   PerftSuite::Result result = suite.run(initial);
+
+   // VERIFY
+   assertUnit(result.name == "initial");
+   assertUnit(result.depth == 3);
+   assertUnit(result.expected == 8902);
+   assertUnit(result.nodes == 8902);
+   assertUnit(result.passed());
+}
+
+/*************************************
+ * RUN all pass
+ * Input : every position, at most 3000 nodes each
+ * Output: every count matches the published one
+ **************************************/
+void TestPerftSuite::run_allPass()
+{
+   // SETUP
+   PerftSuite suite;
+   suite.setMaxNodes(3000);
+   ostringstream sout;
+
+   // EXERCISE
+   vector<PerftSuite::Result> results = suite.run(sout);
+
+   // VERIFY
+   assertUnit(results.size() == PerftSuite::getCases().size());
+   for (const PerftSuite::Result& result : results)
+      assertUnit(result.passed());
+   assertUnit(sout.str().find("FAIL") == string::npos);
+}
+
+/*************************************
+ * RUN all pass fast
+ * Input : every position, at most 3000 nodes each, counting
+ *         the last ply with Board::countMoves()
+ * Output: every count matches the published one
+ **************************************/
+void TestPerftSuite::run_allPassFast()
+{
+   // SETUP
+   PerftSuite suite;
+   suite.setMaxNodes(3000);
+   suite.setFast(true);
+   ostringstream sout;
+
+   // EXERCISE
+   vector<PerftSuite::Result> results = suite.run(sout);
+
+   // VERIFY
+   for (const PerftSuite::Result& result : results)
+      assertUnit(result.passed());
+}
+
+/*************************************
+ * RUN all pass parallel
+ * Input : every position, at most 3000 nodes each, on 3 threads
+ *         sharing a hash table
+ * Output: every count matches the published one
+ **************************************/
+void TestPerftSuite::run_allPassParallel()
+{
+   // SETUP
+   PerftSuite suite;
+   suite.setMaxNodes(3000);
+   suite.setThreads(3);
+   suite.setHash(1);
+   ostringstream sout;
+
+   // EXERCISE
+   vector<PerftSuite::Result> results = suite.run(sout);
+
+   // VERIFY
+   for (const PerftSuite::Result& result : results)
+      assertUnit(result.passed());
+}
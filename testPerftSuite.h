@@ -0,0 +1,35 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PERFT SUITE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for PerftSuite
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * PERFT SUITE TEST
+ * Test the PerftSuite class
+ ***************************************************/
+class TestPerftSuite : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(run_depthWithinMaxNodes);
+      runUnit(run_allPass);
+      runUnit(run_allPassFast);
+      runUnit(run_allPassParallel);
+
+      report("PerftSuite");
+   }
+private:
+   void run_depthWithinMaxNodes();
+   void run_allPass();
+   void run_allPassFast();
+   void run_allPassParallel();
+};
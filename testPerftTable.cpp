@@ -0,0 +1,109 @@
+/***********************************************************************
+ * Source File:
+ *    TEST PERFT TABLE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for PerftTable
+ ************************************************************************/
+
+#include "testPerftTable.h"
+#include "perftTable.h"
+using namespace std;
+
+/*************************************
+ * CONSTRUCT size
+ * Input : 1 megabyte
+ * Output: 65536 entries of 16 bytes
+ **************************************/
+void TestPerftTable::construct_size()
+{
+   // SETUP
+   // EXERCISE
+   PerftTable table(1);
+
+   // VERIFY
+   assertUnit(table.getNumEntries() == 65536);
+   assertUnit(table.getBytes() == 1 << 20);
+   assertUnit(table.mask == 65535);
+}  // TEARDOWN
+
+/*************************************
+ * PROBE empty
+ * Input : nothing stored
+ * Output: not found
+ **************************************/
+void TestPerftTable::probe_empty()
+{
+   // SETUP
+   PerftTable table(1);
+   uint64_t nodes = 99;
+
+   // EXERCISE
+   bool found = table.probe(0x123456789abcdefull, 3, nodes);
+
+   // VERIFY
+   assertUnit(found == false);
+   assertUnit(nodes == 99);
+}  // TEARDOWN
+
+/*************************************
+ * PROBE stored
+ * Input : 8902 stored at depth 3
+ * Output: found, 8902
+ **************************************/
+void TestPerftTable::probe_stored()
+{
+   // SETUP
+   PerftTable table(1);
+   uint64_t nodes = 0;
+   table.store(0x123456789abcdefull, 3, 8902);
+
+   // EXERCISE
+   bool found = table.probe(0x123456789abcdefull, 3, nodes);
+
+   // VERIFY
+   assertUnit(found == true);
+   assertUnit(nodes == 8902);
+}  // TEARDOWN
+
+/*************************************
+ * PROBE other depth
+ * Input : stored at depth 3, probed at depth 4
+ * Output: not found
+ **************************************/
+void TestPerftTable::probe_otherDepth()
+{
+   // SETUP
+   PerftTable table(1);
+   uint64_t nodes = 0;
+   table.store(0x123456789abcdefull, 3, 8902);
+
+   // EXERCISE
+   bool found = table.probe(0x123456789abcdefull, 4, nodes);
+
+   // VERIFY
+   assertUnit(found == false);
+}  // TEARDOWN
+
+/*************************************
+ * PROBE torn
+ * Input : the data word overwritten by another thread's store
+ *         but the check word left from ours
+ * Output: not found
+ **************************************/
+void TestPerftTable::probe_torn()
+{
+   // SETUP
+   PerftTable table(1);
+   uint64_t key = 0x123456789abcdefull;
+   uint64_t nodes = 0;
+   table.store(key, 3, 8902);
+   table.entries[table.index(key, 3)].data = (197281ull << 8) | 3;
+
+   // EXERCISE
+   bool found = table.probe(key, 3, nodes);
+
+   // VERIFY
+   assertUnit(found == false);
+}  // TEARDOWN
@@ -0,0 +1,37 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PERFT TABLE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for PerftTable
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * PERFT TABLE TEST
+ * Test the PerftTable class
+ ***************************************************/
+class TestPerftTable : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_size);
+      runUnit(probe_empty);
+      runUnit(probe_stored);
+      runUnit(probe_otherDepth);
+      runUnit(probe_torn);
+
+      report("PerftTable");
+   }
+private:
+   void construct_size();
+   void probe_empty();
+   void probe_stored();
+   void probe_otherDepth();
+   void probe_torn();
+};
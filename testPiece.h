@@ -21,26 +21,26 @@ public:
 
    void run()
    {
-      assignment();
-
-      equals_same();
-      equals_different();
-      notEquals_same();
-      notEquals_different();
-
-      isWhite_white();
-      isWhite_black();
-      isMoved_initial();
-      isMoved_hasMoved();
-      getNMoves_initial();
-      getNMoves_hasMoved();
-
-      getPosition();
-      justMoved_initial();
-      justMoved_hasMoved();
-      justMoved_justMoved();
-
-      setLastMove();
+      runUnit(assignment);
+
+      runUnit(equals_same);
+      runUnit(equals_different);
+      runUnit(notEquals_same);
+      runUnit(notEquals_different);
+
+      runUnit(isWhite_white);
+      runUnit(isWhite_black);
+      runUnit(isMoved_initial);
+      runUnit(isMoved_hasMoved);
+      runUnit(getNMoves_initial);
+      runUnit(getNMoves_hasMoved);
+
+      runUnit(getPosition);
+      runUnit(justMoved_initial);
+      runUnit(justMoved_hasMoved);
+      runUnit(justMoved_justMoved);
+
+      runUnit(setLastMove);
 
       report("Piece");
    }
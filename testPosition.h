@@ -21,71 +21,71 @@ public:
    void run()
    {
       // Ticket 1: Position Core
-      getRow_zero();
-      getCol_zero();
-      getLocation_zero();
-      isValid_zero();
-      isInvalid_zero();
-      getRow_middle();
-      getCol_middle();
-      getLocation_middle();
-      isValid_middle();
-      isInvalid_middle();
-      getRow_end();
-      getCol_end();
-      getLocation_end();
-      isValid_end();
-      isInvalid_end();
-      getRow_invalid();
-      getCol_invalid();
-      isValid_invalid();
-      isInvalid_invalid();
-      getRow_rowInvalid();
-      getCol_rowInvalid();
-      isValid_rowInvalid();
-      isInvalid_rowInvalid();
-      getRow_colInvalid();
-      getCol_colInvalid();
-      isValid_colInvalid();
-      isInvalid_colInvalid();
-      set_col();
-      set_row();
-      set_both();
-      set_copy();
-      equal_not();
-      equal_equals();
-      lessthan_lessthan();
-      lessthan_equals();
-      lessthan_greaterthan();
-      getX_a1();
-      getY_a1();
-      getX_e7();
-      getY_e7();
-      getWidth_10();
-      getHeight_10();
-      setBoardWidthHeight_10();
-      setBoardWidthHeight_420x830();
-      setXY_a8();
-      setXY_a1();
-      setXY_h8();
-      setXY_h1();
-      setXY_invalidXMin();
-      setXY_invalidXMax();
-      setXY_invalidYMin();
-      setXY_invalidYMax();
+      runUnit(getRow_zero);
+      runUnit(getCol_zero);
+      runUnit(getLocation_zero);
+      runUnit(isValid_zero);
+      runUnit(isInvalid_zero);
+      runUnit(getRow_middle);
+      runUnit(getCol_middle);
+      runUnit(getLocation_middle);
+      runUnit(isValid_middle);
+      runUnit(isInvalid_middle);
+      runUnit(getRow_end);
+      runUnit(getCol_end);
+      runUnit(getLocation_end);
+      runUnit(isValid_end);
+      runUnit(isInvalid_end);
+      runUnit(getRow_invalid);
+      runUnit(getCol_invalid);
+      runUnit(isValid_invalid);
+      runUnit(isInvalid_invalid);
+      runUnit(getRow_rowInvalid);
+      runUnit(getCol_rowInvalid);
+      runUnit(isValid_rowInvalid);
+      runUnit(isInvalid_rowInvalid);
+      runUnit(getRow_colInvalid);
+      runUnit(getCol_colInvalid);
+      runUnit(isValid_colInvalid);
+      runUnit(isInvalid_colInvalid);
+      runUnit(set_col);
+      runUnit(set_row);
+      runUnit(set_both);
+      runUnit(set_copy);
+      runUnit(equal_not);
+      runUnit(equal_equals);
+      runUnit(lessthan_lessthan);
+      runUnit(lessthan_equals);
+      runUnit(lessthan_greaterthan);
+      runUnit(getX_a1);
+      runUnit(getY_a1);
+      runUnit(getX_e7);
+      runUnit(getY_e7);
+      runUnit(getWidth_10);
+      runUnit(getHeight_10);
+      runUnit(setBoardWidthHeight_10);
+      runUnit(setBoardWidthHeight_420x830);
+      runUnit(setXY_a8);
+      runUnit(setXY_a1);
+      runUnit(setXY_h8);
+      runUnit(setXY_h1);
+      runUnit(setXY_invalidXMin);
+      runUnit(setXY_invalidXMax);
+      runUnit(setXY_invalidYMin);
+      runUnit(setXY_invalidYMax);
 
       // Ticket 2: Position Text
-      set_text();
-      set_string();
+      runUnit(set_text);
+      runUnit(set_string);
 
       // Ticket 3: Position Movement
-      adjust_addColumn();
-      adjust_addRow();
-      adjust_offRight();
-      adjust_offTop();
-      adjust_offLeft();
-      adjust_offBottom();
-      adjust_invalid();
+      runUnit(adjust_addColumn);
+      runUnit(adjust_addRow);
+      runUnit(adjust_offRight);
+      runUnit(adjust_offTop);
+      runUnit(adjust_offLeft);
+      runUnit(adjust_offBottom);
+      runUnit(adjust_invalid);
 
       report("Position");
    }
@@ -21,12 +21,12 @@ public:
 
    void run()
    {
-      getMoves_blocked();
-      getMoves_slideToEnd();
-      getMoves_slideToBlock();
-      getMoves_slideToCapture();
+      runUnit(getMoves_blocked);
+      runUnit(getMoves_slideToEnd);
+      runUnit(getMoves_slideToBlock);
+      runUnit(getMoves_slideToCapture);
 
-      getType();
+      runUnit(getType);
 
       report("Rook");
    }
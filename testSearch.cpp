@@ -0,0 +1,567 @@
+/***********************************************************************
+ * Source File:
+ *    TEST SEARCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for Search
+ ************************************************************************/
+
+#include "testSearch.h"
+#include "search.h"
+#include "board.h"
+#include "allocScope.h"
+#include "timeManager.h"
+#include "transpositionTable.h"
+#include <sstream>
+using namespace std;
+
+/*************************************
+ * EVALUATE initial
+ * Input : the initial position
+ * Output: even, the sides mirror each other
+ **************************************/
+void TestSearch::evaluate_initial()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(FEN_INITIAL);
+
+   // EXERCISE
+   int score = Search::evaluate(board);
+
+   // VERIFY
+   assertUnit(score == 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * EVALUATE side to move
+ * Input : white a queen up, with either side to move
+ * Output: good for white, and the same score turned
+ *         around for black
+ **************************************/
+void TestSearch::evaluate_sideToMove()
+{
+   // SETUP
+   Board white(nullptr, true /*noreset*/);
+   Board black(nullptr, true /*noreset*/);
+   white.readFEN("4k3/8/8/8/8/8/8/3QK3 w - - 0 1");
+   black.readFEN("4k3/8/8/8/8/8/8/3QK3 b - - 0 1");
+
+   // EXERCISE
+   int scoreWhite = Search::evaluate(white);
+   int scoreBlack = Search::evaluate(black);
+
+   // VERIFY
+   assertUnit(scoreWhite > 800);
+   assertUnit(scoreBlack == -scoreWhite);
+
+   // TEARDOWN
+   white.free();
+   black.free();
+}
+
+/*************************************
+ * SEARCH mate in one
+ * Input : a back rank mate for white
+ * Output: the rook to the eighth, scored as mate in one ply
+ **************************************/
+void TestSearch::search_mateInOne()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(3);
+
+   // VERIFY
+   assertUnit(score == Search::MATE - 1);
+   assertUnit(Search::isMate(score));
+   assertUnit(search.hasBestMove());
+   assertUnit(search.getBestMove().getUCI() == "a1a8");
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH hanging queen
+ * Input : a black queen the white rook can take for free
+ * Output: the rook takes it
+ **************************************/
+void TestSearch::search_hangingQueen()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4k3/8/8/3q4/8/8/8/3RK3 w - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(2);
+
+   // VERIFY
+   assertUnit(search.getBestMove().getUCI() == "d1d5");
+   assertUnit(score > 300);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH checkmated
+ * Input : black to move and mated on the back rank
+ * Output: mated now, with no move to play
+ **************************************/
+void TestSearch::search_checkmated()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("R5k1/5ppp/8/8/8/8/5PPP/6K1 b - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(3);
+
+   // VERIFY
+   assertUnit(score == -Search::MATE);
+   assertUnit(!search.hasBestMove());
+   assertUnit(search.getNodes() == 1);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH stalemate
+ * Input : black to move with no legal move, not in check
+ * Output: a draw, with no move to play
+ **************************************/
+void TestSearch::search_stalemate()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(3);
+
+   // VERIFY
+   assertUnit(score == 0);
+   assertUnit(!search.hasBestMove());
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH pv
+ * Input : the initial position at depth 3
+ * Output: a line of three moves starting with the best
+ *         move, and the board as it was before the search
+ **************************************/
+void TestSearch::search_pv()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(FEN_INITIAL);
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(3);
+   vector<Move> pv = search.getPV();
+
+   // VERIFY
+   assertUnit(pv.size() == 3);
+   assertUnit(!pv.empty() && pv[0].getUCI() == search.getBestMove().getUCI());
+   assertUnit(score == search.getScore());
+   assertUnit(search.getNodes() > 20);
+   assertUnit(board.getFEN() == FEN_INITIAL);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH no allocation
+ * Input : a middlegame searched twice
+ * Output: the second search allocates nothing, every
+ *         list it needs was made by the first
+ **************************************/
+void TestSearch::search_noAllocation()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   Search search(board);
+   search.search(2);
+   uint64_t nodes;
+
+   // EXERCISE
+   {
+      AllocScope scope("search");
+      search.search(2);
+      nodes = search.getNodes();
+
+      // VERIFY
+      assertUnit(scope.getAllocations() == 0);
+   }
+   assertUnit(nodes > 100);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH iterations
+ * Input : the initial position to depth 4
+ * Output: a line for each of the four iterations, the
+ *         last one at depth 4 and ending with the PV
+ **************************************/
+void TestSearch::search_iterations()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(FEN_INITIAL);
+   Search search(board);
+   ostringstream sout;
+   search.setOutput(&sout);
+
+   // EXERCISE
+   search.search(4);
+
+   // VERIFY
+   string output = sout.str();
+   assertUnit(search.getDepth() == 4);
+   assertUnit(output.find("depth 1 ") == 0);
+   assertUnit(output.find("depth 4 ") != string::npos);
+   assertUnit(output.find("depth 5 ") == string::npos);
+   assertUnit(search.getPV().size() == 4);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH move time
+ * Input : a middlegame with no depth limit and 100 ms
+ * Output: stops in time with a move from a complete
+ *         iteration, the board as it was
+ **************************************/
+void TestSearch::search_moveTime()
+{
+   // SETUP
+   const char* fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(fen);
+   Search search(board);
+   TimeManager time;
+   time.setMoveTime(100);
+
+   // EXERCISE
+   search.search(Search::MAX_PLY, time);
+
+   // VERIFY
+   assertUnit(search.hasBestMove());
+   assertUnit(search.getDepth() >= 1);
+   assertUnit(search.getDepth() < Search::MAX_PLY);
+   assertUnit(search.getPV().size() == (size_t)search.getDepth());
+   assertUnit(board.getFEN() == fen);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH table
+ * Input : a middlegame to depth 4, with and without a table
+ * Output: the same score from fewer nodes with the table,
+ *         which remembers the best move at the root
+ **************************************/
+void TestSearch::search_table()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   TranspositionTable table(1);
+   Search without(board);
+   Search with(board, &table);
+   TranspositionTable::Hit hit;
+
+   // EXERCISE
+   int scoreWithout = without.search(4);
+   int scoreWith = with.search(4);
+
+   // VERIFY
+   assertUnit(scoreWith == scoreWithout);
+   assertUnit(with.getNodes() < without.getNodes());
+   assertUnit(table.probe(board.getHash(), hit));
+   assertUnit(hit.bound == TranspositionTable::EXACT);
+   assertUnit(hit.depth == 4);
+   assertUnit(hit.move == TranspositionTable::pack(with.getBestMove()));
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SET THREAD skips
+ * Input : the first helper, searching to depth 4
+ * Output: only the even iterations, ending at depth 4
+ **************************************/
+void TestSearch::setThread_skips()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(FEN_INITIAL);
+   Search search(board);
+   atomic<bool> abort(false);
+   ostringstream sout;
+   search.setThread(1, &abort);
+   search.setOutput(&sout);
+
+   // EXERCISE
+   search.search(4);
+
+   // VERIFY
+   string output = sout.str();
+   assertUnit(output.find("depth 1 ") == string::npos);
+   assertUnit(output.find("depth 2 ") == 0);
+   assertUnit(output.find("depth 3 ") == string::npos);
+   assertUnit(output.find("depth 4 ") != string::npos);
+   assertUnit(search.getDepth() == 4);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * QUIESCE quiet
+ * Input : the initial position, where nothing can be taken
+ * Output: the static score, after one node
+ **************************************/
+void TestSearch::quiesce_quiet()
+{
+   // SETUP
+   Board board;
+   Search search(board);
+   search.nodes = 0;
+
+   // EXERCISE
+   int score = search.quiesce(0, -Search::INFINITE, Search::INFINITE);
+
+   // VERIFY
+   assertUnit(score == Search::evaluate(board));
+   assertUnit(search.nodes == 1);
+   assertUnit(board.getFEN() == FEN_INITIAL);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * QUIESCE defended pawn
+ * Input : a queen that can take a pawn the d6 pawn defends,
+ *         searched one ply
+ * Output: the leaf sees the recapture, so the pawn is left
+ **************************************/
+void TestSearch::quiesce_defendedPawn()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("4k3/8/3p4/4p3/8/8/8/4QK2 w - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(1);
+
+   // VERIFY
+   assertUnit(search.getBestMove().getUCI() != "e1e5");
+   assertUnit(score > 500);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * QUIESCE mated
+ * Input : black in check with no way out
+ * Output: no standing pat: mated
+ **************************************/
+void TestSearch::quiesce_mated()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("R5k1/5ppp/8/8/8/8/5PPP/6K1 b - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.quiesce(3, -Search::INFINITE, Search::INFINITE);
+
+   // VERIFY
+   assertUnit(score == -Search::MATE + 3);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * GAIN promotion
+ * Input : a quiet move, a capture of a rook, and a capture
+ *         of a rook that promotes to a queen
+ * Output: nothing, the rook, and the rook and the queen
+ *         less the pawn
+ **************************************/
+void TestSearch::gain_promotion()
+{
+   // SETUP
+   Move quiet("e2e4");
+   Move capture("a7b8");
+   capture.setCapture(ROOK);
+   Move promote("a7b8");
+   promote.setCapture(ROOK);
+   promote.setPromotion(QUEEN);
+
+   // EXERCISE
+   int gainQuiet = Search::gain(quiet);
+   int gainCapture = Search::gain(capture);
+   int gainPromote = Search::gain(promote);
+
+   // VERIFY
+   assertUnit(gainQuiet == 0);
+   assertUnit(gainCapture == 500);
+   assertUnit(gainPromote == 500 + 900 - 100);
+}
+
+/*************************************
+ * NEGAMAX null window
+ * Input : the score of a full window search, then a null
+ *         window just below it and just above it
+ * Output: fails high at or above the score, and fails low
+ *         at or below it
+ **************************************/
+void TestSearch::negamax_nullWindow()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+   Search search(board);
+   int score = search.negamax(3, 0, -Search::INFINITE, Search::INFINITE);
+
+   // EXERCISE
+   int below = search.negamax(3, 0, score - 1, score);
+   int above = search.negamax(3, 0, score, score + 1);
+
+   // VERIFY
+   assertUnit(below >= score);
+   assertUnit(above <= score);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * WIDEN inside
+ * Input : a score between alpha and beta
+ * Output: true, and the window is left as it was
+ **************************************/
+void TestSearch::widen_inside()
+{
+   // SETUP
+   int alpha = 85;
+   int beta = 115;
+   int delta = 15;
+
+   // EXERCISE
+   bool inside = Search::widen(100, alpha, beta, delta);
+
+   // VERIFY
+   assertUnit(inside);
+   assertUnit(alpha == 85);
+   assertUnit(beta == 115);
+   assertUnit(delta == 15);
+}  // TEARDOWN
+
+/*************************************
+ * WIDEN fail low
+ * Input : a score at or below alpha
+ * Output: false, alpha moves below the score, beta comes
+ *         down to halfway, and delta grows by half
+ **************************************/
+void TestSearch::widen_failLow()
+{
+   // SETUP
+   int alpha = 85;
+   int beta = 115;
+   int delta = 20;
+
+   // EXERCISE
+   bool inside = Search::widen(40, alpha, beta, delta);
+
+   // VERIFY
+   assertUnit(!inside);
+   assertUnit(alpha == 20);
+   assertUnit(beta == 100);
+   assertUnit(delta == 30);
+}  // TEARDOWN
+
+/*************************************
+ * WIDEN fail high
+ * Input : a score at or above beta, once near a mate
+ * Output: false, beta moves above the score but no further
+ *         than infinite, and alpha is left as it was
+ **************************************/
+void TestSearch::widen_failHigh()
+{
+   // SETUP
+   int alpha = 85;
+   int beta = 115;
+   int delta = 20;
+   int alphaMate = Search::MATE - 20;
+   int betaMate = Search::MATE - 10;
+   int deltaMate = 2000;
+
+   // EXERCISE
+   bool inside = Search::widen(160, alpha, beta, delta);
+   bool insideMate = Search::widen(Search::MATE - 5, alphaMate, betaMate, deltaMate);
+
+   // VERIFY
+   assertUnit(!inside);
+   assertUnit(alpha == 85);
+   assertUnit(beta == 180);
+   assertUnit(delta == 30);
+   assertUnit(!insideMate);
+   assertUnit(alphaMate == Search::MATE - 20);
+   assertUnit(betaMate == Search::INFINITE);
+}  // TEARDOWN
+
+/*************************************
+ * SEARCH aspiration mate
+ * Input : a mate in three, first seen at the fifth
+ *         iteration, after a narrow window around the
+ *         score of two rooks
+ * Output: the window widens all the way to the mate
+ **************************************/
+void TestSearch::search_aspirationMate()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN("8/7k/8/8/8/8/R7/1R4K1 w - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(5);
+
+   // VERIFY
+   assertUnit(score == Search::MATE - 5);
+   assertUnit(search.getDepth() == 5);
+   assertUnit(search.getPV().size() == 5);
+
+   // TEARDOWN
+   board.free();
+}
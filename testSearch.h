@@ -0,0 +1,69 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SEARCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for Search
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * SEARCH TEST
+ * Test the Search class
+ ***************************************************/
+class TestSearch : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(evaluate_initial);
+      runUnit(evaluate_sideToMove);
+      runUnit(search_mateInOne);
+      runUnit(search_hangingQueen);
+      runUnit(search_checkmated);
+      runUnit(search_stalemate);
+      runUnit(search_pv);
+      runUnit(search_noAllocation);
+      runUnit(search_iterations);
+      runUnit(search_moveTime);
+      runUnit(search_table);
+      runUnit(setThread_skips);
+      runUnit(quiesce_quiet);
+      runUnit(quiesce_defendedPawn);
+      runUnit(quiesce_mated);
+      runUnit(gain_promotion);
+      runUnit(negamax_nullWindow);
+      runUnit(widen_inside);
+      runUnit(widen_failLow);
+      runUnit(widen_failHigh);
+      runUnit(search_aspirationMate);
+
+      report("Search");
+   }
+private:
+   void evaluate_initial();
+   void evaluate_sideToMove();
+   void search_mateInOne();
+   void search_hangingQueen();
+   void search_checkmated();
+   void search_stalemate();
+   void search_pv();
+   void search_noAllocation();
+   void search_iterations();
+   void search_moveTime();
+   void search_table();
+   void setThread_skips();
+   void quiesce_quiet();
+   void quiesce_defendedPawn();
+   void quiesce_mated();
+   void gain_promotion();
+   void negamax_nullWindow();
+   void widen_inside();
+   void widen_failLow();
+   void widen_failHigh();
+   void search_aspirationMate();
+};
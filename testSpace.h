@@ -23,10 +23,10 @@ public:
 
    void run()
    {
-      construct_a1();
-      construct_h8();
-      construct_a8();
-      getType();
+      runUnit(construct_a1);
+      runUnit(construct_h8);
+      runUnit(construct_a8);
+      runUnit(getType);
 
       report("Space");
    }
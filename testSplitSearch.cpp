@@ -0,0 +1,185 @@
+/***********************************************************************
+ * Source File:
+ *    TEST SPLIT SEARCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for SplitSearch
+ ************************************************************************/
+
+#include "testSplitSearch.h"
+#include "splitSearch.h"
+#include "board.h"
+using namespace std;
+
+static const char* KIWIPETE = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+
+/*************************************
+ * CONSTRUCT threads
+ * Input : no threads, four, and more than the most
+ * Output: one, four, and the most
+ **************************************/
+void TestSplitSearch::construct_threads()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(FEN_INITIAL);
+
+   // EXERCISE
+   SplitSearch none(board, nullptr, 0);
+   SplitSearch four(board, nullptr, 4);
+   SplitSearch many(board, nullptr, 1000);
+
+   // VERIFY
+   assertUnit(none.getThreads() == 1);
+   assertUnit(four.getThreads() == 4);
+   assertUnit(many.getThreads() == SplitSearch::MAX_THREADS);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH one thread
+ * Input : a middlegame to depth 4 on one thread, and
+ *         with a plain Search, each with an empty table
+ * Output: exactly the same search, and no split points
+ **************************************/
+void TestSplitSearch::search_oneThread()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(KIWIPETE);
+   TranspositionTable tableSplit(1);
+   TranspositionTable tableSearch(1);
+   SplitSearch split(board, &tableSplit, 1);
+   Search search(board, &tableSearch);
+
+   // EXERCISE
+   int scoreSplit = split.search(4);
+   int scoreSearch = search.search(4);
+
+   // VERIFY
+   assertUnit(scoreSplit == scoreSearch);
+   assertUnit(split.getNodes() == search.getNodes());
+   assertUnit(split.getBestMove().getUCI() == search.getBestMove().getUCI());
+   assertUnit(split.getDepth() == 4);
+   assertUnit(split.getSplits() == 0);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH mate in one
+ * Input : a back rank mate on four threads
+ * Output: the mate, and the board as it was
+ **************************************/
+void TestSplitSearch::search_mateInOne()
+{
+   // SETUP
+   const char* fen = "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1";
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(fen);
+   TranspositionTable table(1);
+   SplitSearch split(board, &table, 4);
+
+   // EXERCISE
+   int score = split.search(3);
+
+   // VERIFY
+   assertUnit(score == Search::MATE - 1);
+   assertUnit(split.hasBestMove());
+   assertUnit(split.getBestMove().getUCI() == "a1a8");
+   assertUnit(board.getFEN() == fen);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH same score
+ * Input : a middlegame to depth 3 with no table, on
+ *         one thread and on three
+ * Output: the split points change the order the moves
+ *         finish in, but not the minimax score
+ **************************************/
+void TestSplitSearch::search_sameScore()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(KIWIPETE);
+   SplitSearch one(board, nullptr, 1);
+   SplitSearch three(board, nullptr, 3);
+
+   // EXERCISE
+   int scoreOne = one.search(3);
+   int scoreThree = three.search(3);
+
+   // VERIFY
+   assertUnit(scoreOne == scoreThree);
+   assertUnit(three.getDepth() == 3);
+   assertUnit(three.getSplits() > 0);
+   assertUnit(three.getPV().size() == 3);
+   assertUnit(board.getFEN() == KIWIPETE);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH move time
+ * Input : a middlegame on three threads for 100 ms with
+ *         no depth limit
+ * Output: every thread stops, and there is a move
+ **************************************/
+void TestSplitSearch::search_moveTime()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(KIWIPETE);
+   TranspositionTable table(1);
+   SplitSearch split(board, &table, 3);
+   TimeManager time;
+   time.setMoveTime(100);
+
+   // EXERCISE
+   split.search(Search::MAX_PLY, time);
+
+   // VERIFY
+   assertUnit(split.hasBestMove());
+   assertUnit(split.getDepth() >= 1);
+   assertUnit(split.getDepth() < Search::MAX_PLY);
+   assertUnit(board.getFEN() == KIWIPETE);
+
+   // TEARDOWN
+   board.free();
+}
+
+/*************************************
+ * SEARCH again
+ * Input : two threads, two searches, a move played between
+ * Output: both reach the depth, the second from the new position
+ **************************************/
+void TestSplitSearch::search_again()
+{
+   // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.readFEN(FEN_INITIAL);
+   TranspositionTable table(1);
+   SplitSearch split(board, &table, 2);
+   split.search(4);
+   assertUnit(split.getDepth() == 4);
+   board.move(split.getBestMove());
+
+   // EXERCISE
+   split.search(4);
+
+   // VERIFY
+   assertUnit(split.getDepth() == 4);
+   assertUnit(split.hasBestMove());
+   assertUnit(!board.whiteTurn());
+
+   // TEARDOWN
+   board.free();
+}
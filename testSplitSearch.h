@@ -0,0 +1,39 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SPLIT SEARCH
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for SplitSearch
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * SPLIT SEARCH TEST
+ * Test the SplitSearch class
+ ***************************************************/
+class TestSplitSearch : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_threads);
+      runUnit(search_oneThread);
+      runUnit(search_mateInOne);
+      runUnit(search_sameScore);
+      runUnit(search_moveTime);
+      runUnit(search_again);
+
+      report("SplitSearch");
+   }
+private:
+   void construct_threads();
+   void search_oneThread();
+   void search_mateInOne();
+   void search_sameScore();
+   void search_moveTime();
+   void search_again();
+};
@@ -0,0 +1,99 @@
+/***********************************************************************
+ * Source File:
+ *    TEST THREAD POOL
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for ThreadPool
+ ************************************************************************/
+
+#include "testThreadPool.h"
+#include "threadPool.h"
+#include <atomic>
+using namespace std;
+
+/*************************************
+ * CONSTRUCT size
+ * Input : 3 threads, then 0 threads
+ * Output: 3 workers, then at least 1
+ **************************************/
+void TestThreadPool::construct_size()
+{
+   // SETUP
+   // EXERCISE
+   ThreadPool pool3(3);
+   ThreadPool pool0(0);
+
+   // VERIFY
+   assertUnit(pool3.size() == 3);
+   assertUnit(pool0.size() == 1);
+}  // TEARDOWN
+
+/*************************************
+ * SUBMIT many
+ * Input : 1000 tasks on 4 threads
+ * Output: every task ran exactly once on a valid worker
+ **************************************/
+void TestThreadPool::submit_many()
+{
+   // SETUP
+   ThreadPool pool(4);
+   atomic<int> count(0);
+   atomic<int> badWorker(0);
+
+   // EXERCISE
+   for (int i = 0; i < 1000; i++)
+      pool.submit([&](int worker)
+      {
+         count++;
+         if (worker < 0 || worker >= 4)
+            badWorker++;
+      });
+   pool.wait();
+
+   // VERIFY
+   assertUnit(count == 1000);
+   assertUnit(badWorker == 0);
+}  // TEARDOWN
+
+/*************************************
+ * SUBMIT nested
+ * Input : 10 tasks that each submit 10 more
+ * Output: wait() returns after all 110 have run
+ **************************************/
+void TestThreadPool::submit_nested()
+{
+   // SETUP
+   ThreadPool pool(2);
+   atomic<int> count(0);
+
+   // EXERCISE
+   for (int i = 0; i < 10; i++)
+      pool.submit([&](int)
+      {
+         count++;
+         for (int j = 0; j < 10; j++)
+            pool.submit([&](int) { count++; });
+      });
+   pool.wait();
+
+   // VERIFY
+   assertUnit(count == 110);
+}  // TEARDOWN
+
+/*************************************
+ * WAIT empty
+ * Input : nothing submitted
+ * Output: wait() returns at once
+ **************************************/
+void TestThreadPool::wait_empty()
+{
+   // SETUP
+   ThreadPool pool(2);
+
+   // EXERCISE
+   pool.wait();
+
+   // VERIFY
+   assertUnit(pool.size() == 2);
+}  // TEARDOWN
@@ -0,0 +1,35 @@
+/***********************************************************************
+ * Header File:
+ *    TEST THREAD POOL
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for ThreadPool
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * THREAD POOL TEST
+ * Test the ThreadPool class
+ ***************************************************/
+class TestThreadPool : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_size);
+      runUnit(submit_many);
+      runUnit(submit_nested);
+      runUnit(wait_empty);
+
+      report("ThreadPool");
+   }
+private:
+   void construct_size();
+   void submit_many();
+   void submit_nested();
+   void wait_empty();
+};
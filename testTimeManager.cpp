@@ -0,0 +1,128 @@
+/***********************************************************************
+ * Source File:
+ *    TEST TIME MANAGER
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for TimeManager
+ ************************************************************************/
+
+#include "testTimeManager.h"
+#include "timeManager.h"
+using namespace std;
+
+/*************************************
+ * CONSTRUCT unlimited
+ * Input : nothing
+ * Output: never over and always time to deepen
+ **************************************/
+void TestTimeManager::construct_unlimited()
+{
+   // SETUP
+   TimeManager time;
+
+   // EXERCISE
+   time.start();
+
+   // VERIFY
+   assertUnit(!time.isLimited());
+   assertUnit(!time.isOver());
+   assertUnit(time.canDeepen());
+}
+
+/*************************************
+ * SET MOVE TIME overhead
+ * Input : a second a move
+ * Output: both budgets are the second less the overhead
+ **************************************/
+void TestTimeManager::setMoveTime_overhead()
+{
+   // SETUP
+   TimeManager time;
+
+   // EXERCISE
+   time.setMoveTime(1000);
+
+   // VERIFY
+   assertUnit(time.isLimited());
+   assertUnit(time.getOptimum() == 1000 - TimeManager::OVERHEAD);
+   assertUnit(time.getMaximum() == 1000 - TimeManager::OVERHEAD);
+}
+
+/*************************************
+ * SET CLOCK sudden death
+ * Input : five minutes, no increment, no time control
+ * Output: a share of thirty moves, and three shares at most
+ **************************************/
+void TestTimeManager::setClock_suddenDeath()
+{
+   // SETUP
+   TimeManager time;
+
+   // EXERCISE
+   time.setClock(300000);
+
+   // VERIFY
+   assertUnit(time.getOptimum() == (300000 - TimeManager::OVERHEAD) / 30);
+   assertUnit(time.getMaximum() == time.getOptimum() * 3);
+}
+
+/*************************************
+ * SET CLOCK increment
+ * Input : one minute with a two second increment
+ * Output: most of the increment on top of the share
+ **************************************/
+void TestTimeManager::setClock_increment()
+{
+   // SETUP
+   TimeManager without;
+   TimeManager with;
+
+   // EXERCISE
+   without.setClock(60000);
+   with.setClock(60000, 2000);
+
+   // VERIFY
+   assertUnit(with.getOptimum() == without.getOptimum() + 1500);
+   assertUnit(with.getMaximum() > without.getMaximum());
+}
+
+/*************************************
+ * SET CLOCK moves to go
+ * Input : ten seconds for the last move and for ten moves
+ * Output: all of it for the last move, a tenth each for ten
+ **************************************/
+void TestTimeManager::setClock_movesToGo()
+{
+   // SETUP
+   TimeManager one;
+   TimeManager ten;
+
+   // EXERCISE
+   one.setClock(10000, 0, 1);
+   ten.setClock(10000, 0, 10);
+
+   // VERIFY
+   assertUnit(one.getOptimum() == 10000 - TimeManager::OVERHEAD);
+   assertUnit(one.getMaximum() == 10000 - TimeManager::OVERHEAD);
+   assertUnit(ten.getOptimum() == (10000 - TimeManager::OVERHEAD) / 10);
+   assertUnit(ten.getMaximum() == ten.getOptimum() * 3);
+}
+
+/*************************************
+ * SET CLOCK low on time
+ * Input : less on the clock than the overhead, with a big increment
+ * Output: never more than the clock holds, but never nothing
+ **************************************/
+void TestTimeManager::setClock_lowOnTime()
+{
+   // SETUP
+   TimeManager time;
+
+   // EXERCISE
+   time.setClock(20, 5000);
+
+   // VERIFY
+   assertUnit(time.getOptimum() == 1);
+   assertUnit(time.getMaximum() == 1);
+}
@@ -0,0 +1,39 @@
+/***********************************************************************
+ * Header File:
+ *    TEST TIME MANAGER
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for TimeManager
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * TIME MANAGER TEST
+ * Test the TimeManager class
+ ***************************************************/
+class TestTimeManager : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_unlimited);
+      runUnit(setMoveTime_overhead);
+      runUnit(setClock_suddenDeath);
+      runUnit(setClock_increment);
+      runUnit(setClock_movesToGo);
+      runUnit(setClock_lowOnTime);
+
+      report("TimeManager");
+   }
+private:
+   void construct_unlimited();
+   void setMoveTime_overhead();
+   void setClock_suddenDeath();
+   void setClock_increment();
+   void setClock_movesToGo();
+   void setClock_lowOnTime();
+};
@@ -0,0 +1,184 @@
+/***********************************************************************
+ * Source File:
+ *    TEST TRACE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for Trace. Other suites may run at the same
+ *    time and add their own events, so these look only for theirs
+ ************************************************************************/
+
+#include "testTrace.h"
+#include "trace.h"
+#include "allocScope.h"
+#include <sstream>
+#include <thread>
+using namespace std;
+
+/*************************************
+ * EVENT
+ * The text write() gives a begin or end event
+ **************************************/
+static string event(const char* name, char phase)
+{
+   return string("{\"name\": \"") + name + "\", \"ph\": \"" + phase + "\"";
+}
+
+/*************************************
+ * SCOPE nested
+ * Input : an inner scope inside an outer one
+ * Output: begin outer, begin inner, end inner, end outer
+ **************************************/
+void TestTrace::scope_nested()
+{
+   // SETUP
+   ostringstream sout;
+   Trace::start();
+
+   // EXERCISE
+   {
+      TRACE_SCOPE("testOuter");
+      {
+         TRACE_SCOPE("testInner");
+      }
+   }
+   Trace::stop();
+   Trace::write(sout);
+
+   // VERIFY
+   string text = sout.str();
+   size_t beginOuter = text.find(event("testOuter", 'B'));
+   size_t beginInner = text.find(event("testInner", 'B'));
+   size_t endInner   = text.find(event("testInner", 'E'));
+   size_t endOuter   = text.find(event("testOuter", 'E'));
+   assertUnit(text.find("{\"traceEvents\": [") == 0);
+   assertUnit(beginOuter != string::npos);
+   assertUnit(beginOuter < beginInner);
+   assertUnit(beginInner < endInner);
+   assertUnit(endInner < endOuter);
+   assertUnit(endOuter != string::npos);
+}
+
+/*************************************
+ * SCOPE disabled
+ * Input : a scope while tracing is off
+ * Output: no event
+ **************************************/
+void TestTrace::scope_disabled()
+{
+   // SETUP
+   ostringstream sout;
+   Trace::start();
+   Trace::stop();
+
+   // EXERCISE
+   {
+      TRACE_SCOPE("testDisabled");
+   }
+   Trace::write(sout);
+
+   // VERIFY
+   assertUnit(sout.str().find("testDisabled") == string::npos);
+}
+
+/*************************************
+ * SCOPE end after stop
+ * Input : tracing stops inside a scope
+ * Output: its end is still recorded, so the pair matches
+ **************************************/
+void TestTrace::scope_endAfterStop()
+{
+   // SETUP
+   ostringstream sout;
+   Trace::start();
+
+   // EXERCISE
+   {
+      TRACE_SCOPE("testStopped");
+      Trace::stop();
+   }
+   Trace::write(sout);
+
+   // VERIFY
+   assertUnit(sout.str().find(event("testStopped", 'B')) != string::npos);
+   assertUnit(sout.str().find(event("testStopped", 'E')) != string::npos);
+}
+
+/*************************************
+ * THREAD named
+ * Input : a named thread that records and ends
+ * Output: its name and events are still written
+ **************************************/
+void TestTrace::thread_named()
+{
+   // SETUP
+   ostringstream sout;
+   Trace::start();
+
+   // EXERCISE
+   thread worker([]()
+   {
+      Trace::setThreadName("testWorker");
+      TRACE_SCOPE("testThreadWork");
+   });
+   worker.join();
+   Trace::stop();
+   Trace::write(sout);
+
+   // VERIFY
+   assertUnit(sout.str().find("\"args\": {\"name\": \"testWorker\"}") != string::npos);
+   assertUnit(sout.str().find(event("testThreadWork", 'B')) != string::npos);
+   assertUnit(sout.str().find(event("testThreadWork", 'E')) != string::npos);
+}
+
+/*************************************
+ * RECORD dropped
+ * Input : ten more events than a buffer holds
+ * Output: the ten are dropped and counted
+ **************************************/
+void TestTrace::record_dropped()
+{
+   // SETUP
+   Trace::start();
+
+   // EXERCISE
+   thread worker([]()
+   {
+      for (size_t i = 0; i < Trace::EVENTS_PER_THREAD + 10; i++)
+         Trace::begin("testFull");
+   });
+   worker.join();
+   Trace::stop();
+   size_t dropped = Trace::getDropped();
+
+   // VERIFY
+   assertUnit(dropped >= 10);
+}
+
+/*************************************
+ * RECORD no allocations
+ * Input : the first event on a new thread, which
+ *         takes a new buffer
+ * Output: nothing counted by AllocScope
+ **************************************/
+void TestTrace::record_noAllocations()
+{
+   // SETUP
+   size_t allocations = 1;
+   Trace::start();
+
+   // EXERCISE
+   thread worker([&allocations]()
+   {
+      AllocScope scope;
+      {
+         TRACE_SCOPE("testAllocations");
+      }
+      allocations = scope.getAllocations();
+   });
+   worker.join();
+   Trace::stop();
+
+   // VERIFY
+   assertUnit(allocations == 0);
+}
@@ -0,0 +1,39 @@
+/***********************************************************************
+ * Header File:
+ *    TEST TRACE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for Trace
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * TRACE TEST
+ * Test the Trace class
+ ***************************************************/
+class TestTrace : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(scope_nested);
+      runUnit(scope_disabled);
+      runUnit(scope_endAfterStop);
+      runUnit(thread_named);
+      runUnit(record_dropped);
+      runUnit(record_noAllocations);
+
+      report("Trace");
+   }
+private:
+   void scope_nested();
+   void scope_disabled();
+   void scope_endAfterStop();
+   void thread_named();
+   void record_dropped();
+   void record_noAllocations();
+};
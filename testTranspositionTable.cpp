@@ -0,0 +1,204 @@
+/***********************************************************************
+ * Source File:
+ *    TEST TRANSPOSITION TABLE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for TranspositionTable
+ ************************************************************************/
+
+#include "testTranspositionTable.h"
+#include "transpositionTable.h"
+#include "move.h"
+using namespace std;
+
+/*************************************
+ * CONSTRUCT size
+ * Input : 1 megabyte
+ * Output: 16384 buckets of one cache line, four entries each
+ **************************************/
+void TestTranspositionTable::construct_size()
+{
+   // SETUP
+   // EXERCISE
+   TranspositionTable table(1);
+
+   // VERIFY
+   assertUnit(sizeof(TranspositionTable::Bucket) == 64);
+   assertUnit(alignof(TranspositionTable::Bucket) == 64);
+   assertUnit(table.getNumBuckets() == 16384);
+   assertUnit(table.getNumEntries() == 65536);
+   assertUnit(table.getBytes() == 1 << 20);
+   assertUnit(((uintptr_t)table.buckets & 63) == 0);
+}  // TEARDOWN
+
+/*************************************
+ * PROBE empty
+ * Input : nothing stored
+ * Output: not found, not even for the key 0
+ **************************************/
+void TestTranspositionTable::probe_empty()
+{
+   // SETUP
+   TranspositionTable table(1);
+   TranspositionTable::Hit hit;
+
+   // EXERCISE
+   bool found = table.probe(0x123456789abcdefull, hit);
+   bool foundZero = table.probe(0, hit);
+
+   // VERIFY
+   assertUnit(found == false);
+   assertUnit(foundZero == false);
+   assertUnit(table.getHashfull() == 0);
+}  // TEARDOWN
+
+/*************************************
+ * PROBE stored
+ * Input : a move, a negative score, depth 7, a lower bound
+ * Output: all of it back
+ **************************************/
+void TestTranspositionTable::probe_stored()
+{
+   // SETUP
+   TranspositionTable table(1);
+   TranspositionTable::Hit hit = { 0, 0, 0, TranspositionTable::NONE };
+   table.store(0x123456789abcdefull, 0x0abc, -30990, 7, TranspositionTable::LOWER);
+
+   // EXERCISE
+   bool found = table.probe(0x123456789abcdefull, hit);
+
+   // VERIFY
+   assertUnit(found == true);
+   assertUnit(hit.move == 0x0abc);
+   assertUnit(hit.score == -30990);
+   assertUnit(hit.depth == 7);
+   assertUnit(hit.bound == TranspositionTable::LOWER);
+}  // TEARDOWN
+
+/*************************************
+ * PROBE torn
+ * Input : the data word overwritten by another thread's store
+ *         but the check word left from ours
+ * Output: not found
+ **************************************/
+void TestTranspositionTable::probe_torn()
+{
+   // SETUP
+   TranspositionTable table(1);
+   TranspositionTable::Hit hit;
+   uint64_t key = 0x123456789abcdefull;
+   table.store(key, 0x0abc, 25, 7, TranspositionTable::EXACT);
+   TranspositionTable::Entry& entry = table.buckets[key & table.mask].entries[0];
+   entry.data = TranspositionTable::encode(0x0def, -400, 9, TranspositionTable::EXACT, 0);
+
+   // EXERCISE
+   bool found = table.probe(key, hit);
+
+   // VERIFY
+   assertUnit(found == false);
+}  // TEARDOWN
+
+/*************************************
+ * STORE keeps move
+ * Input : a position stored with a move, then again without one
+ * Output: the new score and depth with the old move
+ **************************************/
+void TestTranspositionTable::store_keepsMove()
+{
+   // SETUP
+   TranspositionTable table(1);
+   TranspositionTable::Hit hit;
+   uint64_t key = 0x123456789abcdefull;
+   table.store(key, 0x0abc, 25, 3, TranspositionTable::EXACT);
+
+   // EXERCISE
+   table.store(key, 0, -60, 5, TranspositionTable::UPPER);
+
+   // VERIFY
+   assertUnit(table.probe(key, hit));
+   assertUnit(hit.move == 0x0abc);
+   assertUnit(hit.score == -60);
+   assertUnit(hit.depth == 5);
+   assertUnit(hit.bound == TranspositionTable::UPPER);
+}  // TEARDOWN
+
+/*************************************
+ * STORE replaces shallowest
+ * Input : a full bucket at depths 5, 2, 8, 6, then a fifth key
+ * Output: the depth 2 entry is the one gone
+ **************************************/
+void TestTranspositionTable::store_replacesShallowest()
+{
+   // SETUP
+   TranspositionTable table(1);
+   TranspositionTable::Hit hit;
+   uint64_t buckets = table.getNumBuckets();
+   int depths[4] = { 5, 2, 8, 6 };
+   for (int i = 0; i < 4; i++)
+      table.store(7 + buckets * (i + 1), 0, 0, depths[i], TranspositionTable::EXACT);
+
+   // EXERCISE
+   table.store(7 + buckets * 5, 0, 0, 1, TranspositionTable::EXACT);
+
+   // VERIFY
+   assertUnit(table.probe(7 + buckets * 1, hit));
+   assertUnit(!table.probe(7 + buckets * 2, hit));
+   assertUnit(table.probe(7 + buckets * 3, hit));
+   assertUnit(table.probe(7 + buckets * 4, hit));
+   assertUnit(table.probe(7 + buckets * 5, hit));
+}  // TEARDOWN
+
+/*************************************
+ * STORE replaces oldest
+ * Input : a deep entry from two searches ago among shallow
+ *         ones from this search, then a new key
+ * Output: the old deep entry is the one gone
+ **************************************/
+void TestTranspositionTable::store_replacesOldest()
+{
+   // SETUP
+   TranspositionTable table(1);
+   TranspositionTable::Hit hit;
+   uint64_t buckets = table.getNumBuckets();
+   table.store(7 + buckets * 1, 0, 0, 12, TranspositionTable::EXACT);
+   table.newSearch();
+   table.newSearch();
+   for (int i = 2; i <= 4; i++)
+      table.store(7 + buckets * i, 0, 0, 3, TranspositionTable::EXACT);
+
+   // EXERCISE
+   table.store(7 + buckets * 5, 0, 0, 1, TranspositionTable::EXACT);
+
+   // VERIFY
+   assertUnit(!table.probe(7 + buckets * 1, hit));
+   assertUnit(table.probe(7 + buckets * 2, hit));
+   assertUnit(table.probe(7 + buckets * 5, hit));
+   assertUnit(table.getHashfull() > 0);
+}  // TEARDOWN
+
+/*************************************
+ * PACK promotion
+ * Input : a7a8 promoting to a queen and to a knight
+ * Output: different packed moves, neither empty
+ **************************************/
+void TestTranspositionTable::pack_promotion()
+{
+   // SETUP
+   Move queen("a7a8");
+   Move knight("a7a8");
+   Move plain("e2e4");
+   queen.setPromotion(QUEEN);
+   knight.setPromotion(KNIGHT);
+
+   // EXERCISE
+   uint16_t packedQueen = TranspositionTable::pack(queen);
+   uint16_t packedKnight = TranspositionTable::pack(knight);
+   uint16_t packedPlain = TranspositionTable::pack(plain);
+
+   // VERIFY
+   assertUnit(packedQueen != 0);
+   assertUnit(packedPlain != 0);
+   assertUnit(packedQueen != packedKnight);
+   assertUnit((packedQueen & 0xfff) == (packedKnight & 0xfff));
+}  // TEARDOWN
@@ -0,0 +1,43 @@
+/***********************************************************************
+ * Header File:
+ *    TEST TRANSPOSITION TABLE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    The unit tests for TranspositionTable
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * TRANSPOSITION TABLE TEST
+ * Test the TranspositionTable class
+ ***************************************************/
+class TestTranspositionTable : public UnitTest
+{
+public:
+   void run()
+   {
+      runUnit(construct_size);
+      runUnit(probe_empty);
+      runUnit(probe_stored);
+      runUnit(probe_torn);
+      runUnit(store_keepsMove);
+      runUnit(store_replacesShallowest);
+      runUnit(store_replacesOldest);
+      runUnit(pack_promotion);
+
+      report("TranspositionTable");
+   }
+private:
+   void construct_size();
+   void probe_empty();
+   void probe_stored();
+   void probe_torn();
+   void store_keepsMove();
+   void store_replacesShallowest();
+   void store_replacesOldest();
+   void pack_promotion();
+};
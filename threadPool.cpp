@@ -0,0 +1,157 @@
+/***********************************************************************
+ * Source File:
+ *    THREAD POOL
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    A fixed set of worker threads that share tasks by work stealing
+ ************************************************************************/
+
+#include "threadPool.h"
+#include "trace.h"
+#include <cstdio>
+using namespace std;
+
+// which worker of which pool the current thread is, if any
+static thread_local const ThreadPool* pPoolCurrent = nullptr;
+static thread_local int workerCurrent = -1;
+
+/***************************************************
+ * THREAD POOL : CONSTRUCTOR
+ * Start the workers, each with an empty queue
+ ***************************************************/
+ThreadPool::ThreadPool(int numThreads) : pending(0), queued(0), next(0), stopping(false)
+{
+   if (numThreads < 1)
+      numThreads = 1;
+
+   for (int i = 0; i < numThreads; i++)
+      queues.push_back(unique_ptr<Queue>(new Queue));
+   for (int i = 0; i < numThreads; i++)
+      threads.push_back(thread(&ThreadPool::work, this, i));
+}
+
+/***************************************************
+ * THREAD POOL : DESTRUCTOR
+ * Finish what was submitted, then stop the workers
+ ***************************************************/
+ThreadPool::~ThreadPool()
+{
+   wait();
+   {
+      lock_guard<mutex> lock(mutexIdle);
+      stopping = true;
+   }
+   cvWork.notify_all();
+   for (thread& t : threads)
+      t.join();
+}
+
+/***************************************************
+ * THREAD POOL : SUBMIT
+ * Queue a task on the current worker, or spread them round robin
+ ***************************************************/
+void ThreadPool::submit(Task task)
+{
+   int worker = (pPoolCurrent == this) ? workerCurrent
+                                       : (int)(next++ % queues.size());
+   pending++;
+   {
+      lock_guard<mutex> lock(queues[worker]->mutex);
+      queues[worker]->tasks.push_back(std::move(task));
+      queued++;
+   }
+
+   // under the idle lock, so a worker is either asleep and woken, or
+   // has yet to look at queued and will see this task
+   lock_guard<mutex> lock(mutexIdle);
+   cvWork.notify_one();
+}
+
+/***************************************************
+ * THREAD POOL : WAIT
+ * Block until every submitted task has finished
+ ***************************************************/
+void ThreadPool::wait()
+{
+   unique_lock<mutex> lock(mutexIdle);
+   cvDone.wait(lock, [this]() { return pending == 0; });
+}
+
+/***************************************************
+ * THREAD POOL : POP
+ * Take the newest task from our own queue
+ ***************************************************/
+bool ThreadPool::pop(int worker, Task& task)
+{
+   Queue& queue = *queues[worker];
+   lock_guard<mutex> lock(queue.mutex);
+   if (queue.tasks.empty())
+      return false;
+   task = std::move(queue.tasks.back());
+   queue.tasks.pop_back();
+   queued--;
+   return true;
+}
+
+/***************************************************
+ * THREAD POOL : STEAL
+ * Take the oldest task, usually the biggest, from someone else
+ ***************************************************/
+bool ThreadPool::steal(int worker, Task& task)
+{
+   int num = (int)queues.size();
+   for (int i = 1; i < num; i++)
+   {
+      Queue& queue = *queues[(worker + i) % num];
+      lock_guard<mutex> lock(queue.mutex);
+      if (!queue.tasks.empty())
+      {
+         task = std::move(queue.tasks.front());
+         queue.tasks.pop_front();
+         queued--;
+         return true;
+      }
+   }
+   return false;
+}
+
+/***************************************************
+ * THREAD POOL : WORK
+ * The loop each worker runs until the pool stops
+ ***************************************************/
+void ThreadPool::work(int worker)
+{
+   pPoolCurrent = this;
+   workerCurrent = worker;
+   char name[32];
+   snprintf(name, sizeof(name), "worker %d", worker);
+   Trace::setThreadName(name);
+
+   for (;;)
+   {
+      Task task;
+      if (pop(worker, task) || steal(worker, task))
+      {
+         {
+            TRACE_SCOPE("task");
+            task(worker);
+         }
+         if (--pending == 0)
+         {
+            lock_guard<mutex> lock(mutexIdle);
+            cvDone.notify_all();
+         }
+         continue;
+      }
+
+      // nothing anywhere: sleep until a submit or the pool stops. A
+      // submit that lands between our look and our sleep is seen here,
+      // as queued is checked under the lock submit notifies under
+      unique_lock<mutex> lock(mutexIdle);
+      if (stopping)
+         return;
+      TRACE_SCOPE("idle");
+      cvWork.wait(lock, [this]() { return stopping || queued > 0; });
+   }
+}
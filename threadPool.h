@@ -0,0 +1,64 @@
+/***********************************************************************
+ * Header File:
+ *    THREAD POOL
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    A fixed set of worker threads that share tasks by work stealing
+ ************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+/***************************************************
+ * THREAD POOL
+ * Each worker has its own queue of tasks. It takes work from the back
+ * of its own queue and, when that runs dry, steals from the front of
+ * another worker's queue. A task is told which worker is running it so
+ * it can use per-worker state such as its own copy of the board.
+ ***************************************************/
+class ThreadPool
+{
+public:
+   typedef std::function<void(int worker)> Task;
+
+   ThreadPool(int numThreads = (int)std::thread::hardware_concurrency());
+   ~ThreadPool();
+
+   // add a task. From inside a task it goes on that worker's own queue
+   void submit(Task task);
+
+   // block until every submitted task has finished
+   void wait();
+
+   int size() const { return (int)threads.size(); }
+
+private:
+   struct Queue
+   {
+      std::mutex        mutex;
+      std::deque<Task>  tasks;
+   };
+
+   void work(int worker);
+   bool pop(int worker, Task& task);
+   bool steal(int worker, Task& task);
+
+   std::vector<std::unique_ptr<Queue>> queues;   // one per worker
+   std::vector<std::thread> threads;
+   std::atomic<int>  pending;                    // submitted but not finished
+   std::atomic<int>  queued;                     // submitted but not yet taken
+   std::atomic<int>  next;                       // round robin for outside submits
+   std::atomic<bool> stopping;
+   std::mutex        mutexIdle;
+   std::condition_variable cvWork;               // there may be work to do
+   std::condition_variable cvDone;               // pending reached zero
+};
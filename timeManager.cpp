@@ -0,0 +1,42 @@
+/***********************************************************************
+ * Source File:
+ *    TIME MANAGER
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    How long a search may take, from the clock: a fixed time per move,
+ *    or the time left with an increment and the moves until the next
+ *    time control. Sudden death is a clock with no moves to go
+ ************************************************************************/
+
+#include "timeManager.h"
+#include <algorithm>
+using namespace std;
+
+/***************************************************
+ * TIME MANAGER : SET MOVE TIME
+ * The whole time, less the overhead, but never nothing
+ ***************************************************/
+void TimeManager::setMoveTime(int ms)
+{
+   limited = true;
+   optimum = maximum = max(1, ms - OVERHEAD);
+}
+
+/***************************************************
+ * TIME MANAGER : SET CLOCK
+ * An even share of what is left over the moves to come,
+ * plus most of the increment. A hard position may take
+ * up to three shares, but never more than the clock holds
+ ***************************************************/
+void TimeManager::setClock(int time, int increment, int movesToGo)
+{
+   limited = true;
+   int safe = max(1, time - OVERHEAD);
+   int movesLeft = MOVES_LEFT;
+   if (movesToGo > 0 && movesToGo < movesLeft)
+      movesLeft = movesToGo;
+
+   optimum = min(safe, max(1, safe / movesLeft + increment * 3 / 4));
+   maximum = min(safe, optimum * 3);
+}
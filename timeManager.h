@@ -0,0 +1,71 @@
+/***********************************************************************
+ * Header File:
+ *    TIME MANAGER
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    How long a search may take, from the clock: a fixed time per move,
+ *    or the time left with an increment and the moves until the next
+ *    time control. Sudden death is a clock with no moves to go
+ ************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+class TestTimeManager;
+
+/***************************************************
+ * TIME MANAGER
+ * Two budgets for one move. The optimum is what the search
+ * should spend, so it does not start an iteration it is
+ * unlikely to finish. The maximum is where it must stop,
+ * even in the middle of an iteration
+ ***************************************************/
+class TimeManager
+{
+   friend TestTimeManager;
+public:
+   // kept back from the clock for the move to be made and sent, in ms
+   static const int OVERHEAD = 30;
+
+   // moves left in the game assumed when there is no time control
+   static const int MOVES_LEFT = 30;
+
+   // no limit: search to the depth asked for
+   TimeManager() : limited(false), optimum(0), maximum(0) {}
+
+   // exactly this long for the move
+   void setMoveTime(int ms);
+
+   // time left on the clock, added after each move, and the moves until
+   // the next time control (0 for sudden death)
+   void setClock(int time, int increment = 0, int movesToGo = 0);
+
+   // the clock starts for this move
+   void start() { begin = std::chrono::steady_clock::now(); }
+
+   bool isLimited()  const { return limited; }
+   int  getOptimum() const { return optimum; }
+   int  getMaximum() const { return maximum; }
+
+   // milliseconds since start()
+   double getElapsed() const
+   {
+      return std::chrono::duration<double, std::milli>(
+         std::chrono::steady_clock::now() - begin).count();
+   }
+
+   // the search must stop now
+   bool isOver() const { return limited && getElapsed() >= maximum; }
+
+   // there is time for another iteration. Each takes about as long as
+   // all the ones before it, so past half the optimum it would overrun
+   bool canDeepen() const { return !limited || getElapsed() < optimum / 2.0; }
+
+private:
+   bool limited;
+   int optimum;     // ms the move should take
+   int maximum;     // ms the move may take
+   std::chrono::steady_clock::time_point begin;
+};
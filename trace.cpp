@@ -0,0 +1,306 @@
+/***********************************************************************
+ * Source File:
+ *    TRACE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    A timeline of what each thread was doing, written as Chrome
+ *    trace events so it can be opened in chrome://tracing or Perfetto.
+ *    Each thread records into its own buffer without locks, and when
+ *    tracing is off a traced scope only pays for one check
+ ************************************************************************/
+
+#include "trace.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <new>
+using namespace std;
+
+/***************************************************
+ * TRACE BUFFER
+ * One thread's events. Only the owning thread writes them,
+ * and it publishes each with a release store of the count,
+ * so write() can read them without a lock
+ ***************************************************/
+struct TraceBuffer
+{
+   enum State { FREE, LIVE, RETIRED };
+
+   struct Event
+   {
+      const char* name;
+      uint64_t    time;     // nanoseconds since start()
+      char        phase;    // 'B' or 'E'
+   };
+
+   atomic<int>      state;     // FREE to take, LIVE while its thread runs
+   atomic<uint64_t> session;   // the start() its events belong to
+   atomic<size_t>   count;
+   atomic<size_t>   dropped;
+   int              tid;       // the thread's number in the timeline
+   char             name[32];
+   Event            events[Trace::EVENTS_PER_THREAD];
+};
+
+// every buffer ever made. They are reused, never freed
+static const int MAX_BUFFERS = 256;
+static atomic<TraceBuffer*> buffers[MAX_BUFFERS];
+static atomic<int>          numBuffers(0);
+
+atomic<bool>            Trace::enabled(false);
+static atomic<uint64_t> session(0);
+static atomic<int64_t>  epoch(0);     // steady clock nanoseconds at start()
+static string           fileTrace;    // for --trace
+
+/***************************************************
+ * OWNER
+ * The calling thread's buffer and name. When the thread
+ * ends its buffer is retired: kept for write(), then
+ * free to reuse after the next start()
+ ***************************************************/
+struct Owner
+{
+   TraceBuffer* pBuffer = nullptr;
+   char name[32] = { 0 };
+   ~Owner()
+   {
+      if (pBuffer)
+         pBuffer->state.store(TraceBuffer::RETIRED, memory_order_release);
+   }
+};
+static thread_local Owner owner;
+
+static int64_t now()
+{
+   return chrono::duration_cast<chrono::nanoseconds>(
+      chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/***************************************************
+ * TRACE : START
+ ***************************************************/
+void Trace::start()
+{
+   epoch.store(now(), memory_order_relaxed);
+   session.fetch_add(1, memory_order_release);
+
+   // the threads that ended during the last timeline have been written
+   int n = numBuffers.load(memory_order_acquire);
+   for (int i = 0; i < n && i < MAX_BUFFERS; i++)
+   {
+      TraceBuffer* pBuffer = buffers[i].load(memory_order_acquire);
+      int retired = TraceBuffer::RETIRED;
+      if (pBuffer)
+         pBuffer->state.compare_exchange_strong(retired, TraceBuffer::FREE);
+   }
+   enabled.store(true, memory_order_release);
+}
+
+/***************************************************
+ * TRACE : STOP
+ ***************************************************/
+void Trace::stop()
+{
+   enabled.store(false, memory_order_release);
+}
+
+/***************************************************
+ * TRACE : BEGIN and END
+ ***************************************************/
+void Trace::begin(const char* name)
+{
+   record(name, 'B');
+}
+
+void Trace::end(const char* name)
+{
+   record(name, 'E');
+}
+
+/***************************************************
+ * TRACE : SET THREAD NAME
+ ***************************************************/
+void Trace::setThreadName(const char* name)
+{
+   strncpy(owner.name, name, sizeof(owner.name) - 1);
+   if (owner.pBuffer)
+      strncpy(owner.pBuffer->name, owner.name, sizeof(owner.pBuffer->name));
+}
+
+/***************************************************
+ * GET BUFFER
+ * The calling thread's buffer: a free one if there is one,
+ * otherwise a new one. The buffers come from malloc() so that
+ * the AllocScope counts do not see them. Null once there are
+ * more threads than buffers
+ ***************************************************/
+static TraceBuffer* getBuffer()
+{
+   if (owner.pBuffer)
+      return owner.pBuffer;
+
+   TraceBuffer* pBuffer = nullptr;
+   int n = numBuffers.load(memory_order_acquire);
+   for (int i = 0; i < n && i < MAX_BUFFERS && !pBuffer; i++)
+   {
+      TraceBuffer* pCandidate = buffers[i].load(memory_order_acquire);
+      int available = TraceBuffer::FREE;
+      if (pCandidate && pCandidate->state.compare_exchange_strong(available, TraceBuffer::LIVE))
+         pBuffer = pCandidate;
+   }
+
+   if (!pBuffer)
+   {
+      int i = numBuffers.fetch_add(1);
+      if (i >= MAX_BUFFERS)
+         return nullptr;
+      void* p = malloc(sizeof(TraceBuffer));
+      if (p == nullptr)
+         return nullptr;
+      pBuffer = new (p) TraceBuffer;
+      pBuffer->state.store(TraceBuffer::LIVE, memory_order_relaxed);
+      pBuffer->session.store(0, memory_order_relaxed);
+      pBuffer->count.store(0, memory_order_relaxed);
+      pBuffer->dropped.store(0, memory_order_relaxed);
+      pBuffer->tid = i + 1;
+      buffers[i].store(pBuffer, memory_order_release);
+   }
+
+   memcpy(pBuffer->name, owner.name, sizeof(pBuffer->name));
+   owner.pBuffer = pBuffer;
+   return pBuffer;
+}
+
+/***************************************************
+ * TRACE : RECORD
+ * Append one event. A buffer last used for an older
+ * timeline is emptied first, by its own thread
+ ***************************************************/
+void Trace::record(const char* name, char phase)
+{
+   TraceBuffer* pBuffer = getBuffer();
+   if (!pBuffer)
+      return;
+
+   uint64_t current = session.load(memory_order_acquire);
+   if (pBuffer->session.load(memory_order_relaxed) != current)
+   {
+      pBuffer->count.store(0, memory_order_relaxed);
+      pBuffer->dropped.store(0, memory_order_relaxed);
+      pBuffer->session.store(current, memory_order_release);
+   }
+
+   size_t i = pBuffer->count.load(memory_order_relaxed);
+   if (i >= EVENTS_PER_THREAD)
+   {
+      pBuffer->dropped.fetch_add(1, memory_order_relaxed);
+      return;
+   }
+   pBuffer->events[i].name = name;
+   pBuffer->events[i].time = (uint64_t)(now() - epoch.load(memory_order_relaxed));
+   pBuffer->events[i].phase = phase;
+   pBuffer->count.store(i + 1, memory_order_release);
+}
+
+/***************************************************
+ * TRACE : GET DROPPED
+ ***************************************************/
+size_t Trace::getDropped()
+{
+   size_t dropped = 0;
+   uint64_t current = session.load(memory_order_acquire);
+   int n = numBuffers.load(memory_order_acquire);
+   for (int i = 0; i < n && i < MAX_BUFFERS; i++)
+   {
+      TraceBuffer* pBuffer = buffers[i].load(memory_order_acquire);
+      if (pBuffer && pBuffer->session.load(memory_order_acquire) == current)
+         dropped += pBuffer->dropped.load(memory_order_relaxed);
+   }
+   return dropped;
+}
+
+/***************************************************
+ * TRACE : WRITE
+ * The Chrome trace event format: a name for each thread,
+ * then its begin and end events in microseconds
+ ***************************************************/
+void Trace::write(ostream& out)
+{
+   ios::fmtflags flags = out.flags();
+   streamsize precision = out.precision();
+   out << fixed << setprecision(3);
+
+   const char* separator = "\n";
+   out << "{\"traceEvents\": [";
+   uint64_t current = session.load(memory_order_acquire);
+   int n = numBuffers.load(memory_order_acquire);
+   for (int i = 0; i < n && i < MAX_BUFFERS; i++)
+   {
+      TraceBuffer* pBuffer = buffers[i].load(memory_order_acquire);
+      if (!pBuffer || pBuffer->session.load(memory_order_acquire) != current)
+         continue;
+
+      char name[sizeof(pBuffer->name) + 1] = { 0 };
+      memcpy(name, pBuffer->name, sizeof(pBuffer->name));
+      if (name[0] == '\0')
+         snprintf(name, sizeof(name), "thread %d", pBuffer->tid);
+      out << separator << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+          << pBuffer->tid << ", \"args\": {\"name\": \"" << name << "\"}}";
+      separator = ",\n";
+
+      size_t count = pBuffer->count.load(memory_order_acquire);
+      for (size_t e = 0; e < count; e++)
+      {
+         const TraceBuffer::Event& event = pBuffer->events[e];
+         out << separator << "{\"name\": \"" << event.name << "\", \"ph\": \"" << event.phase
+             << "\", \"pid\": 1, \"tid\": " << pBuffer->tid
+             << ", \"ts\": " << event.time / 1000.0 << "}";
+      }
+   }
+   out << "\n], \"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped\": "
+       << getDropped() << "}}\n";
+
+   out.flags(flags);
+   out.precision(precision);
+}
+
+bool Trace::write(const string& fileName)
+{
+   ofstream fout(fileName);
+   if (!fout)
+      return false;
+   write(fout);
+   return (bool)fout;
+}
+
+/***************************************************
+ * TRACE : COMMAND LINE
+ ***************************************************/
+int Trace::commandLine(int argc, char** argv)
+{
+   for (int i = 1; i + 1 < argc; i++)
+      if (string(argv[i]) == "--trace")
+      {
+         fileTrace = argv[i + 1];
+         for (int j = i; j + 2 <= argc; j++)
+            argv[j] = argv[j + 2];
+         argc -= 2;
+
+         setThreadName("main");
+         start();
+         atexit([]()
+         {
+            stop();
+            if (write(fileTrace))
+               cerr << "Trace written to " << fileTrace << "\n";
+            else
+               cerr << "Could not write the trace to " << fileTrace << "\n";
+         });
+         break;
+      }
+   return argc;
+}
@@ -0,0 +1,105 @@
+/***********************************************************************
+ * Header File:
+ *    TRACE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    A timeline of what each thread was doing, written as Chrome
+ *    trace events so it can be opened in chrome://tracing or Perfetto.
+ *    Each thread records into its own buffer without locks, and when
+ *    tracing is off a traced scope only pays for one check
+ ************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <string>
+#include <iostream>
+
+using std::string;
+using std::ostream;
+
+class TestTrace;
+
+/***************************************************
+ * TRACE
+ * Begin and end events by thread. The buffers are not freed
+ * and not counted by AllocScope, so tracing does not change
+ * what the allocation tests measure
+ ***************************************************/
+class Trace
+{
+   friend TestTrace;
+public:
+   // events kept per thread. Past this they are dropped and counted
+   static const size_t EVENTS_PER_THREAD = 1 << 18;
+
+   // start a new timeline, forgetting the last one. Call it
+   // while no traced work is running
+   static void start();
+   static void stop();
+   static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+   // record an event on the calling thread. The name must outlive
+   // the trace, so use a string literal
+   static void begin(const char* name);
+   static void end(const char* name);
+
+   // the name the calling thread has in the timeline
+   static void setThreadName(const char* name);
+
+   // the timeline as Chrome trace JSON. Call it after stop()
+   static void write(ostream& out);
+   static bool write(const string& fileName);
+
+   // events lost because a thread's buffer was full
+   static size_t getDropped();
+
+   // handle "--trace file" anywhere on the command line: start tracing,
+   // write the file when the program exits, and take the two
+   // arguments out. Returns the new argc
+   static int commandLine(int argc, char** argv);
+
+private:
+   static void record(const char* name, char phase);
+
+   static std::atomic<bool> enabled;
+};
+
+/***************************************************
+ * TRACE SCOPE
+ * Begin on construction, end on destruction. The end is
+ * recorded whenever the begin was, so the pairs always match
+ ***************************************************/
+class TraceScope
+{
+public:
+   TraceScope(const char* name) : name(Trace::isEnabled() ? name : nullptr)
+   {
+      if (this->name)
+         Trace::begin(this->name);
+   }
+   ~TraceScope()
+   {
+      if (name)
+         Trace::end(name);
+   }
+   TraceScope(const TraceScope&) = delete;
+   TraceScope& operator = (const TraceScope&) = delete;
+
+private:
+   const char* name;
+};
+
+// NTRACE takes the tracing out of the build altogether
+#ifdef NTRACE
+#define TRACE_SCOPE(name)
+#define TRACE_FUNCTION()
+#else
+#define TRACE_CONCAT2(a, b) a##b
+#define TRACE_CONCAT(a, b)  TRACE_CONCAT2(a, b)
+#define TRACE_SCOPE(name)   TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_FUNCTION()    TRACE_SCOPE(__FUNCTION__)
+#endif
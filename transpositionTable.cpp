@@ -0,0 +1,147 @@
+/***********************************************************************
+ * Source File:
+ *    TRANSPOSITION TABLE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    What the search has learned about each position it has seen,
+ *    shared by every thread without locks
+ ************************************************************************/
+
+#include "transpositionTable.h"
+#include "memoryReport.h"
+#include "move.h"
+using namespace std;
+
+/***************************************************
+ * NUM BUCKETS
+ * The largest power of two that fits in the megabytes
+ ***************************************************/
+static size_t numBuckets(size_t megabytes, size_t bucketSize)
+{
+   size_t num = (megabytes << 20) / bucketSize;
+   size_t size = 1;
+   while (size * 2 <= num)
+      size *= 2;
+   return size;
+}
+
+/***************************************************
+ * TRANSPOSITION TABLE : CONSTRUCTOR
+ * The buckets are all zero, and every bit of zero is
+ * an empty entry, so the memory needs no constructing
+ ***************************************************/
+TranspositionTable::TranspositionTable(size_t megabytes) :
+   mask(numBuckets(megabytes, sizeof(Bucket)) - 1),
+   memory((mask + 1) * sizeof(Bucket)),
+   buckets((Bucket*)memory.get()),
+   generation(0)
+{
+   clear();
+}
+
+/***************************************************
+ * TRANSPOSITION TABLE : PROBE
+ * Any entry in the position's bucket whose key checks out
+ ***************************************************/
+bool TranspositionTable::probe(uint64_t key, Hit& hit) const
+{
+   const Bucket& bucket = buckets[key & mask];
+   for (const Entry& entry : bucket.entries)
+   {
+      uint64_t data  = entry.data.load(memory_order_relaxed);
+      uint64_t check = entry.check.load(memory_order_relaxed);
+      if ((check ^ data) != key || getBound(data) == NONE)
+         continue;
+
+      hit.move  = getMove(data);
+      hit.score = getScore(data);
+      hit.depth = getDepth(data);
+      hit.bound = getBound(data);
+      return true;
+   }
+   return false;
+}
+
+/***************************************************
+ * TRANSPOSITION TABLE : STORE
+ * Over the position's own entry if it has one. Otherwise
+ * over the least worth keeping: the shallowest, with eight
+ * plies taken off for each search since it was stored
+ ***************************************************/
+void TranspositionTable::store(uint64_t key, uint16_t move, int score, int depth, Bound bound)
+{
+   Bucket& bucket = buckets[key & mask];
+   Entry* pReplace = nullptr;
+   int worthReplace = 0;
+   for (Entry& entry : bucket.entries)
+   {
+      uint64_t data  = entry.data.load(memory_order_relaxed);
+      uint64_t check = entry.check.load(memory_order_relaxed);
+      if ((check ^ data) == key && getBound(data) != NONE)
+      {
+         if (move == 0)
+            move = getMove(data);
+         pReplace = &entry;
+         break;
+      }
+
+      int age = (generation - getGeneration(data)) & GENERATION_MASK;
+      int worth = getBound(data) == NONE ? -1000 : getDepth(data) - 8 * age;
+      if (pReplace == nullptr || worth < worthReplace)
+      {
+         pReplace = &entry;
+         worthReplace = worth;
+      }
+   }
+
+   uint64_t data = encode(move, score, depth, bound, generation);
+   pReplace->check.store(key ^ data, memory_order_relaxed);
+   pReplace->data.store(data, memory_order_relaxed);
+}
+
+/***************************************************
+ * TRANSPOSITION TABLE : CLEAR
+ * Empty every entry. No bound means empty
+ ***************************************************/
+void TranspositionTable::clear()
+{
+   memory.clear();
+   generation = 0;
+}
+
+/***************************************************
+ * TRANSPOSITION TABLE : GET HASHFULL
+ * From a sample of the first thousand buckets
+ ***************************************************/
+int TranspositionTable::getHashfull() const
+{
+   size_t sample = getNumBuckets() < 1000 ? getNumBuckets() : 1000;
+   size_t used = 0;
+   for (size_t i = 0; i < sample; i++)
+      for (const Entry& entry : buckets[i].entries)
+      {
+         uint64_t data = entry.data.load(memory_order_relaxed);
+         if (getBound(data) != NONE && getGeneration(data) == generation)
+            used++;
+      }
+   return (int)(used * 1000 / (sample * ENTRIES_PER_BUCKET));
+}
+
+/***************************************************
+ * TRANSPOSITION TABLE : PACK
+ ***************************************************/
+uint16_t TranspositionTable::pack(const Move& move)
+{
+   return (uint16_t)(move.getSrc().getLocation() |
+                     move.getDest().getLocation() << 6 |
+                     (move.getPromotion() & 7) << 12);
+}
+
+/***************************************************
+ * TRANSPOSITION TABLE : MEMORY REPORT
+ ***************************************************/
+void TranspositionTable::memoryReport(MemoryReport& report) const
+{
+   report.add("Hash", "Transposition table buckets", getNumBuckets(), getBytes() + sizeof(TranspositionTable));
+}
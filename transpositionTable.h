@@ -0,0 +1,110 @@
+/***********************************************************************
+ * Header File:
+ *    TRANSPOSITION TABLE
+ * Author:
+ *    Jessen Forbush & Roger Galan
+ * Summary:
+ *    What the search has learned about each position it has seen,
+ *    shared by every thread without locks
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <string>
+#include "hashMemory.h"
+
+class Move;
+class TestTranspositionTable;
+class MemoryReport;
+
+/***************************************************
+ * TRANSPOSITION TABLE
+ * Buckets of four entries, one cache line each, found by the
+ * Zobrist key. An entry is two words written without a lock:
+ * the packed data, and the key XOR the data. An entry torn by
+ * two threads writing at once fails the key check on the next
+ * probe instead of returning another position's score
+ ***************************************************/
+class TranspositionTable
+{
+   friend TestTranspositionTable;
+public:
+   // what the score says about the true score
+   enum Bound { NONE = 0, UPPER = 1, LOWER = 2, EXACT = 3 };
+
+   // what is known about a position
+   struct Hit
+   {
+      uint16_t move;     // packed, 0 for none
+      int      score;
+      int      depth;
+      Bound    bound;
+   };
+
+   static const int ENTRIES_PER_BUCKET = 4;
+
+   TranspositionTable(size_t megabytes);
+
+   // how the memory was allocated, for the start of a run
+   std::string describe() const { return memory.describe(); }
+
+   // what is stored for this position, if anything
+   bool probe(uint64_t key, Hit& hit) const;
+
+   // remember a result. A move of 0 keeps the one already stored
+   void store(uint64_t key, uint16_t move, int score, int depth, Bound bound);
+
+   // a new search: what older ones stored is replaced first
+   void newSearch() { generation = (generation + 1) & GENERATION_MASK; }
+
+   // empty every entry, each thread clearing its share of the pages
+   void clear();
+
+   // entries in use by the current search, per thousand
+   int getHashfull() const;
+
+   size_t getNumBuckets() const { return mask + 1; }
+   size_t getNumEntries() const { return getNumBuckets() * ENTRIES_PER_BUCKET; }
+   size_t getBytes()      const { return getNumBuckets() * sizeof(Bucket); }
+
+   void memoryReport(MemoryReport& report) const;
+
+   // a move in 16 bits: source, destination, and promotion
+   static uint16_t pack(const Move& move);
+
+private:
+   static const int GENERATION_MASK = 0x3f;
+
+   struct Entry
+   {
+      std::atomic<uint64_t> check;   // key ^ data
+      std::atomic<uint64_t> data;    // generation, bound, depth, score, move
+   };
+
+   struct alignas(64) Bucket
+   {
+      Entry entries[ENTRIES_PER_BUCKET];
+   };
+
+   static uint64_t encode(uint16_t move, int score, int depth, Bound bound, int generation)
+   {
+      return (uint64_t)move |
+             (uint64_t)(uint16_t)(int16_t)score << 16 |
+             (uint64_t)(depth & 0xff) << 32 |
+             (uint64_t)bound << 40 |
+             (uint64_t)generation << 42;
+   }
+   static uint16_t getMove(uint64_t data)       { return (uint16_t)data; }
+   static int      getScore(uint64_t data)      { return (int16_t)(uint16_t)(data >> 16); }
+   static int      getDepth(uint64_t data)      { return (int)(data >> 32) & 0xff; }
+   static Bound    getBound(uint64_t data)      { return (Bound)((data >> 40) & 3); }
+   static int      getGeneration(uint64_t data) { return (int)(data >> 42) & GENERATION_MASK; }
+
+   size_t mask;                       // number of buckets - 1, a power of two
+   HashMemory memory;
+   Bucket* buckets;
+   int generation;                    // of the current search
+};
@@ -40,6 +40,7 @@
 #endif // _WIN32
 
 #include "uiInteract.h"
+#include "trace.h"     // for TRACE_SCOPE
 
 using namespace std;
 
@@ -102,6 +103,7 @@ void sleep(unsigned long msSleep)
  *************************************************************************/
 void drawCallback()
 {
+   TRACE_SCOPE("drawCallback");
    // even though this is a local variable, all the members are static
    Interface ui;
    // Prepare the background buffer for drawing
@@ -114,13 +116,19 @@ void drawCallback()
    
    //loop until the timer runs out
    if (!ui.isTimeToDraw())
+   {
+      TRACE_SCOPE("wait for frame");
       sleep((unsigned long)((ui.getNextTick() - clock()) / 1000));
+   }
 
    // from this point, set the next draw time
    ui.setNextDrawTime();
 
    // bring forth the background buffer
-   glutSwapBuffers();
+   {
+      TRACE_SCOPE("glutSwapBuffers");
+      glutSwapBuffers();
+   }
 
 }
 
@@ -19,17 +19,42 @@
 
 #define assertEquals(value, test) assertUnitParameters(closeEnough(value, test), #test, __LINE__, __FUNCTION__)
 #define assertUnit(condition)              assertUnitParameters(condition, #condition, __LINE__, __FUNCTION__)
+#define runUnit(test)                      runUnitParameters([this]() { test(); }, #test)
 
 #include <iostream>  // for std::cerr
 #include <iomanip>   // for std::setw
 #include <string>    // for std::string
 #include <vector>    // for std::vector
 #include <map>       // for std::map
+#include <functional> // for std::function
+#include <chrono>    // for std::chrono::steady_clock
 
 class UnitTest
 {
 public:
    UnitTest() { reset(); }
+
+   // how long one test case took, as run from the suite's run()
+   struct Timing
+   {
+      std::string name;
+      double      seconds;
+   };
+
+   // where report() writes, so suites running at the same time
+   // do not interleave their output
+   void setOutput(std::ostream& out) { this->out = &out; }
+
+   // only run the test cases whose names contain one of these.
+   // An empty list runs them all
+   void setFilter(const std::vector<std::string>& filters) { this->filters = filters; }
+
+   // the totals of every report() so far
+   int getNumTests()  const { return numTests;  }
+   int getNumFailed() const { return numFailed; }
+
+   // every case run so far, in the order they ran
+   const std::vector<Timing>& getTimings() const { return timings; }
    
 private:
    // a test failure is a failure string and a line number
@@ -42,6 +67,12 @@ private:
    // each test has a name (the key) and the list of failures(value).
    std::map<std::string, std::vector<Failure>> tests;
 
+   std::ostream* out = &std::cout;
+   std::vector<std::string> filters;
+   int numTests = 0;
+   int numFailed = 0;
+   std::vector<Timing> timings;
+
 protected:
 
    // for closeEnough() and assertEquals(), what is the tolerance?
@@ -73,19 +104,23 @@ protected:
       for (auto & test : tests)
          if (!test.second.empty())
          {
-            std::cout << "\t" << test.first << "()\n";
+            *out << "\t" << test.first << "()\n";
             for (auto & failure : test.second)
-               std::cout << "\t\tline:"   << failure.lineNumber
-                         << " condition:" << failure.failure << "\n";
+               *out << "\t\tline:"   << failure.lineNumber
+                    << " condition:" << failure.failure << "\n";
          }
 
+      // a filter that selected nothing from this suite
+      if (tests.empty() && !filters.empty())
+         return;
+
       // name the test case
-      std::cout << std::left << std::setw(15) << name << ":\t";
+      *out << std::left << std::setw(15) << name << ":\t";
 
       // handle the no test case
       if (tests.empty())
       {
-         std::cout << "There were no tests]\n";
+         *out << "There were no tests]\n";
          return;
       }
 
@@ -93,12 +128,14 @@ protected:
       int numSuccess = 0;
       for (auto& test : tests)
          numSuccess += (test.second.empty() ? 1 : 0);
+      numTests += (int)tests.size();
+      numFailed += (int)tests.size() - numSuccess;
       double successRate = (double)numSuccess / (double)tests.size();
 
       // display the summary
-      std::cout.setf(std::ios::fixed | std::ios::showpoint);
-      std::cout.precision(1);
-      std::cout << "There were "
+      out->setf(std::ios::fixed | std::ios::showpoint);
+      out->precision(1);
+      *out << "There were "
          << tests.size()
          << " tests run for a success rate of: "
          << (successRate * 100.0) << "%\n";
@@ -128,6 +165,27 @@ protected:
          tests[sFunc];
       }
    }
+
+   /*************************************************************
+    * RUN UNIT PARAMETERS
+    * Run one test case, unless the filter leaves it out, and
+    * time it
+    *************************************************************/
+   void runUnitParameters(const std::function<void()>& test, const char* name)
+   {
+      if (!filters.empty())
+      {
+         bool selected = false;
+         for (auto& filter : filters)
+            selected = selected || std::string(name).find(filter) != std::string::npos;
+         if (!selected)
+            return;
+      }
+      auto begin = std::chrono::steady_clock::now();
+      test();
+      auto end = std::chrono::steady_clock::now();
+      timings.push_back({ name, std::chrono::duration<double>(end - begin).count() });
+   }
    
 
 };